@@ -0,0 +1,64 @@
+/**
+ * @file bench_huffman.cpp
+ * @brief Mide la velocidad en MB/s de la compresión y descompresión Huffman
+ *
+ * Comprime y descomprime en memoria con huffmanCompress/huffmanDecompress tres
+ * entradas sintéticas de 32 MB (texto, registros binarios y bytes aleatorios), o los
+ * archivos indicados, y muestra la razón de compresión y la velocidad de cada sentido
+ * medida sobre los bytes sin comprimir. Cada resultado se verifica contra la entrada.
+ *
+ * Compilar y ejecutar:
+ *   g++ -std=c++17 -O2 bench_huffman.cpp -o bench_huffman
+ *   ./bench_huffman [maxBits] [archivo...]
+ *
+ * maxBits (por defecto HUFFMAN_MAX_BITS) es la longitud máxima de los códigos.
+ */
+
+#include "../src/functions/conversions.cpp"
+#include "../src/functions/numbers.cpp"
+#include "../src/functions/strings.cpp"
+#include "../src/functions/validations.cpp"
+#include "../src/tads/BitReader.cpp"
+#include "../src/tads/BitWriter.cpp"
+#include "../src/tads/Huffman.cpp"
+#include "bench_utils.cpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+const int BENCH_LEN = 32 << 20;
+
+void bench(const char* nombre, const std::vector<unsigned char>& d, int maxBits) {
+    BitWriter bw = bitWriter();
+    const auto t0 = std::chrono::steady_clock::now();
+    huffmanCompress(bw, d.data(), (int) d.size(), maxBits);
+    bitWriterFlush(bw);
+    const double tc = seconds(t0);
+
+    BitReader br = bitReader(bitWriterData(bw), bitWriterSize(bw));
+    const auto t1 = std::chrono::steady_clock::now();
+    const std::vector<unsigned char> o = huffmanDecompress(br);
+    const double td = seconds(t1);
+
+    const double mb = d.size() / 1048576.0;
+    printf("%-20s %9.1f %7.3f %10.1f %10.1f%s\n", nombre, mb, (double) bitWriterSize(bw) / d.size(),
+           mb / tc, mb / td, o == d ? "" : "  ERROR: no coincide");
+}
+
+int main(int argc, char* argv[]) {
+    const int maxBits = argc > 1 ? atoi(argv[1]) : HUFFMAN_MAX_BITS;
+
+    printf("%-20s %9s %7s %10s %10s\n", "entrada", "MB", "razón", "comp MB/s", "desc MB/s");
+    if (argc > 2) {
+        for (int i = 2; i < argc; i++) {
+            bench(argv[i], fileInput(argv[i]), maxBits);
+        }
+        return 0;
+    }
+    bench("texto", textInput(BENCH_LEN), maxBits);
+    bench("binario", binaryInput(BENCH_LEN), maxBits);
+    bench("aleatorio", randomInput(BENCH_LEN), maxBits);
+    return 0;
+}
@@ -0,0 +1,70 @@
+/**
+ * @file bench_lzss.cpp
+ * @brief Mide la razón de compresión y la velocidad en MB/s de LZSS
+ *
+ * Comprime y descomprime en memoria con lzssCompress/lzssDecompress tres entradas
+ * sintéticas de 16 MB (texto, registros binarios y bytes aleatorios), o los archivos
+ * indicados, con varias combinaciones de ventana y evaluación diferida. Muestra la
+ * razón de compresión y la velocidad de cada sentido medida sobre los bytes sin
+ * comprimir. Cada resultado se verifica contra la entrada.
+ *
+ * Compilar y ejecutar:
+ *   g++ -std=c++17 -O2 bench_lzss.cpp -o bench_lzss
+ *   ./bench_lzss [archivo...]
+ */
+
+#include "../src/functions/conversions.cpp"
+#include "../src/functions/numbers.cpp"
+#include "../src/functions/strings.cpp"
+#include "../src/functions/validations.cpp"
+#include "../src/tads/BitReader.cpp"
+#include "../src/tads/BitWriter.cpp"
+#include "../src/tads/Lzss.cpp"
+#include "bench_utils.cpp"
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+const int BENCH_LEN = 16 << 20;
+
+void bench(const char* nombre, const std::vector<unsigned char>& d, int windowBits, int lazy) {
+    BitWriter bw = bitWriter();
+    const auto t0 = std::chrono::steady_clock::now();
+    lzssCompress(bw, d.data(), (int) d.size(), windowBits, lazy);
+    bitWriterFlush(bw);
+    const double tc = seconds(t0);
+
+    BitReader br = bitReader(bitWriterData(bw), bitWriterSize(bw));
+    const auto t1 = std::chrono::steady_clock::now();
+    const std::vector<unsigned char> o = lzssDecompress(br);
+    const double td = seconds(t1);
+
+    const double mb = d.size() / 1048576.0;
+    printf("%-20s %7d %5d %9.1f %7.3f %10.1f %10.1f%s\n", nombre, windowBits, lazy, mb,
+           (double) bitWriterSize(bw) / d.size(), mb / tc, mb / td, o == d ? "" : "  ERROR: no coincide");
+}
+
+// ventana y evaluación diferida de cada medición
+const int CONFIGS[][2] = {{12, 0}, {16, 0}, {16, 1}, {20, 2}};
+
+void benchAll(const char* nombre, const std::vector<unsigned char>& d) {
+    for (const int* c: CONFIGS) {
+        bench(nombre, d, c[0], c[1]);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    printf("%-20s %7s %5s %9s %7s %10s %10s\n", "entrada", "ventana", "lazy", "MB", "razón", "comp MB/s",
+           "desc MB/s");
+    if (argc > 1) {
+        for (int i = 1; i < argc; i++) {
+            benchAll(argv[i], fileInput(argv[i]));
+        }
+        return 0;
+    }
+    benchAll("texto", textInput(BENCH_LEN));
+    benchAll("binario", binaryInput(BENCH_LEN));
+    benchAll("aleatorio", randomInput(BENCH_LEN));
+    return 0;
+}
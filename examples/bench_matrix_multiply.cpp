@@ -0,0 +1,107 @@
+/**
+ * @file bench_matrix_multiply.cpp
+ * @brief Compara en GFLOP/s mtxMultiply con el producto ingenuo de tres bucles
+ *
+ * Multiplica matrices cuadradas de double de 64 a 4096 filas con mtxMultiply (por
+ * bloques y vectorizado) y con el triple bucle i-j-k sobre las mismas matrices, y
+ * muestra el rendimiento de cada uno y la diferencia máxima entre los resultados.
+ *
+ * Compilar y ejecutar:
+ *   g++ -std=c++17 -O2 -march=native -pthread bench_matrix_multiply.cpp -o bench_matrix_multiply
+ *   ./bench_matrix_multiply [maxN] [maxNIngenuo]
+ *
+ * maxN (por defecto 4096) acota el tamaño más grande; maxNIngenuo (por defecto igual a
+ * maxN) acota los tamaños en que se mide el triple bucle, que con 4096 tarda varios
+ * minutos.
+ */
+
+#include "../src/tads/Matrix.cpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+Matrix<double> randomMatrix(int n, unsigned semilla) {
+    std::mt19937 rng(semilla);
+    std::uniform_real_distribution<double> u(-1.0, 1.0);
+    Matrix<double> m = matrix<double>(n, n, 0.0);
+    for (int i = 0; i < n; i++) {
+        double* fila = mtxRow(m, i);
+        for (int j = 0; j < n; j++) {
+            fila[j] = u(rng);
+        }
+    }
+    return m;
+}
+
+Matrix<double> naiveMultiply(const Matrix<double>& a, const Matrix<double>& b) {
+    Matrix<double> c = matrix<double>(a.f, b.c, 0.0);
+    for (int i = 0; i < a.f; i++) {
+        const double* ai = mtxRow(a, i);
+        double* ci = mtxRow(c, i);
+        for (int j = 0; j < b.c; j++) {
+            double s = 0;
+            for (int k = 0; k < a.c; k++) {
+                s += ai[k] * mtxRow(b, k)[j];
+            }
+            ci[j] = s;
+        }
+    }
+    return c;
+}
+
+double maxDiff(const Matrix<double>& x, const Matrix<double>& y) {
+    double d = 0;
+    for (int i = 0; i < x.f; i++) {
+        for (int j = 0; j < x.c; j++) {
+            d = std::max(d, std::fabs(mtxRow(x, i)[j] - mtxRow(y, i)[j]));
+        }
+    }
+    return d;
+}
+
+// repite el producto hasta acumular al menos 0,2 s y retorna los segundos por producto
+template<typename Fn>
+double timeMultiply(const Matrix<double>& a, const Matrix<double>& b, Matrix<double>& c, Fn fn) {
+    int reps = 0;
+    double seg = 0;
+    while (seg < 0.2) {
+        mtxFree<double>(c);
+        const auto t0 = std::chrono::steady_clock::now();
+        c = fn(a, b);
+        const auto t1 = std::chrono::steady_clock::now();
+        seg += std::chrono::duration<double>(t1 - t0).count();
+        reps++;
+    }
+    return seg / reps;
+}
+
+int main(int argc, char* argv[]) {
+    const int maxN = argc > 1 ? atoi(argv[1]) : 4096;
+    const int maxNIngenuo = argc > 2 ? atoi(argv[2]) : maxN;
+
+    printf("%6s %14s %14s %10s %12s\n", "n", "mtxMultiply", "ingenuo", "acel.", "dif. máx.");
+    for (int n = 64; n <= maxN; n *= 2) {
+        Matrix<double> a = randomMatrix(n, 1);
+        Matrix<double> b = randomMatrix(n, 2);
+        const double flops = 2.0 * n * n * n;
+
+        Matrix<double> c = matrix<double>(0, 0, 0.0);
+        const double tBloques = timeMultiply(a, b, c, mtxMultiply<double>);
+        printf("%6d %8.2f GF/s", n, flops / tBloques * 1e-9);
+        if (n <= maxNIngenuo) {
+            Matrix<double> r = matrix<double>(0, 0, 0.0);
+            const double tIngenuo = timeMultiply(a, b, r, naiveMultiply);
+            printf(" %8.2f GF/s %9.1fx %12.2e\n", flops / tIngenuo * 1e-9, tIngenuo / tBloques, maxDiff(c, r));
+            mtxFree<double>(r);
+        } else {
+            printf(" %14s %10s %12s\n", "-", "-", "-");
+        }
+        mtxFree<double>(c);
+        mtxFree<double>(a);
+        mtxFree<double>(b);
+    }
+    return 0;
+}
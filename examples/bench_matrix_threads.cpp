@@ -0,0 +1,75 @@
+/**
+ * @file bench_matrix_threads.cpp
+ * @brief Mide cómo escalan mtxRowSums, mtxColSums y mtxMap con la cantidad de hilos
+ *
+ * Ejecuta cada operación sobre matrices de double de distintos tamaños con 1, 2, 4, ...
+ * hilos y muestra el tiempo por llamada y la aceleración respecto de un hilo. Las
+ * matrices chicas muestran el costo fijo de repartir el trabajo; las grandes, el
+ * límite que impone el ancho de banda de memoria.
+ *
+ * Compilar y ejecutar:
+ *   g++ -std=c++17 -O2 -march=native -pthread bench_matrix_threads.cpp -o bench_matrix_threads
+ *   ./bench_matrix_threads [maxHilos]
+ *
+ * maxHilos (por defecto los núcleos disponibles) acota la cantidad de hilos.
+ */
+
+#include "../src/tads/Matrix.cpp"
+#include "bench_utils.cpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+double scale(double x) {
+    return x * 1.000001 + 0.5;
+}
+
+template<typename Fn>
+double timeCall(Fn fn) {
+    fn();
+    int reps = 0;
+    double seg = 0;
+    while (seg < 0.2) {
+        const auto t0 = std::chrono::steady_clock::now();
+        fn();
+        const auto t1 = std::chrono::steady_clock::now();
+        seg += std::chrono::duration<double>(t1 - t0).count();
+        reps++;
+    }
+    return seg / reps * 1e6;
+}
+
+template<typename Fn>
+void bench(const char* op, int f, int c, int maxHilos, Fn fn) {
+    double base = 0;
+    for (int h: threadCounts(maxHilos)) {
+        const double us = timeCall([&fn, h]() { fn(h); });
+        if (h == 1) {
+            base = us;
+        }
+        printf("%-10s %5dx%-5d %6d %13.1f %8.2fx\n", op, f, c, h, us, base / us);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int maxHilos = argc > 1 ? atoi(argv[1]) : (int) std::thread::hardware_concurrency();
+    if (maxHilos < 1) {
+        maxHilos = 1;
+    }
+
+    const int tam[][2] = {{64, 64}, {512, 512}, {4096, 4096}, {100000, 64}};
+    printf("%-10s %11s %6s %13s %9s\n", "op", "f x c", "hilos", "us/llamada", "acel.");
+    for (const int* t: tam) {
+        Matrix<double> m = matrix<double>(t[0], t[1], 1.0);
+        std::vector<double> filas(m.f);
+        std::vector<double> cols(m.c);
+        bench("rowSums", m.f, m.c, maxHilos, [&](int h) { mtxRowSums<double>(m, filas.data(), h); });
+        bench("colSums", m.f, m.c, maxHilos, [&](int h) { mtxColSums<double>(m, cols.data(), h); });
+        bench("map", m.f, m.c, maxHilos, [&](int h) { mtxMap<double>(m, scale, h); });
+        mtxFree<double>(m);
+    }
+    return 0;
+}
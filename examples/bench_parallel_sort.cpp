@@ -0,0 +1,102 @@
+/**
+ * @file bench_parallel_sort.cpp
+ * @brief Mide la aceleración de parallelSort según la cantidad de hilos
+ *
+ * Ordena arrays de int y de std::string de 10^6 a 10^8 elementos con 1, 2, 4, ...
+ * hilos y muestra el tiempo y la aceleración respecto de un hilo. Cada resultado se
+ * verifica contra el orden esperado.
+ *
+ * Compilar y ejecutar:
+ *   g++ -std=c++17 -O2 -pthread bench_parallel_sort.cpp -o bench_parallel_sort
+ *   ./bench_parallel_sort [maxLen] [maxHilos]
+ *
+ * maxLen (por defecto 10^8) acota el tamaño más grande; maxHilos (por defecto los
+ * núcleos disponibles) acota la cantidad de hilos. Con 10^8 strings se necesitan
+ * unos 8 GB de memoria, por lo que conviene empezar con maxLen = 10^7.
+ */
+
+#include "../src/functions/arrays.cpp"
+#include "bench_utils.cpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+int cmpInt(int a, int b) {
+    return a < b ? -1 : (a > b ? 1 : 0);
+}
+
+int cmpString(std::string a, std::string b) {
+    return a.compare(b);
+}
+
+std::vector<int> randomInts(int n) {
+    std::mt19937 rng(12345);
+    std::vector<int> v(n);
+    for (int i = 0; i < n; i++) {
+        v[i] = (int) rng();
+    }
+    return v;
+}
+
+std::vector<std::string> randomStrings(int n) {
+    std::mt19937 rng(12345);
+    std::vector<std::string> v(n);
+    for (int i = 0; i < n; i++) {
+        // entre 6 y 14 letras: entran en el buffer interno de std::string
+        const int len = 6 + (int) (rng() % 9);
+        v[i].resize(len);
+        for (int k = 0; k < len; k++) {
+            v[i][k] = (char) ('a' + rng() % 26);
+        }
+    }
+    return v;
+}
+
+template<typename T>
+bool isSorted(const std::vector<T>& v, int cmpTT(T, T)) {
+    for (size_t i = 1; i < v.size(); i++) {
+        if (cmpTT(v[i - 1], v[i]) > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename T>
+void bench(const char* tipo, const std::vector<T>& datos, int cmpTT(T, T), int maxHilos) {
+    double base = 0;
+    for (int h: threadCounts(maxHilos)) {
+        std::vector<T> v = datos;
+        const auto t0 = std::chrono::steady_clock::now();
+        parallelSort<T>(v.data(), (int) v.size(), cmpTT, h);
+        const auto t1 = std::chrono::steady_clock::now();
+        const double ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+        if (h == 1) {
+            base = ms;
+        }
+        printf("%-8s %11d %6d %11.1f %8.2fx%s\n", tipo, (int) v.size(), h, ms, base / ms,
+               isSorted<T>(v, cmpTT) ? "" : "  ERROR: no quedó ordenado");
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const long long maxLen = argc > 1 ? atoll(argv[1]) : 100000000LL;
+    int maxHilos = argc > 2 ? atoi(argv[2]) : (int) std::thread::hardware_concurrency();
+    if (maxHilos < 1) {
+        maxHilos = 1;
+    }
+
+    printf("%-8s %11s %6s %11s %9s\n", "tipo", "n", "hilos", "ms", "acel.");
+    for (long long n = 1000000; n <= maxLen; n *= 10) {
+        bench<int>("int", randomInts((int) n), cmpInt, maxHilos);
+    }
+    for (long long n = 1000000; n <= maxLen; n *= 10) {
+        bench<std::string>("string", randomStrings((int) n), cmpString, maxHilos);
+    }
+    return 0;
+}
@@ -0,0 +1,86 @@
+/**
+ * @file bench_utils.cpp
+ * @brief Funciones auxiliares compartidas por los programas de medición
+ *
+ * Se incluye directamente desde cada bench_*.cpp, igual que las fuentes de src/.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+// 1, 2, 4, ... hasta maxHilos, incluyéndolo aunque no sea potencia de 2
+std::vector<int> threadCounts(int maxHilos) {
+    std::vector<int> hs;
+    for (int h = 1; h < maxHilos; h *= 2) {
+        hs.push_back(h);
+    }
+    hs.push_back(maxHilos);
+    return hs;
+}
+
+// len bytes de líneas de log con palabras de frecuencia decreciente
+std::vector<unsigned char> textInput(int len) {
+    const char* palabras[] = {"GET", "POST", "/api/v1/items", "/index.html", "200", "404", "INFO", "WARN",
+                              "request", "handled", "user", "id", "status", "time", "ms", "ok"};
+    std::mt19937 rng(1);
+    std::geometric_distribution<int> g(0.25);
+    std::string s;
+    while ((int) s.size() < len) {
+        s += "2023-10-17 12:" + std::to_string(10 + rng() % 50) + ":" + std::to_string(10 + rng() % 50);
+        for (int k = 0; k < 8; k++) {
+            s += ' ';
+            s += palabras[std::min(g(rng), 15)];
+        }
+        s += " " + std::to_string(rng() % 100000) + "\n";
+    }
+    return std::vector<unsigned char>(s.begin(), s.begin() + len);
+}
+
+// len bytes de registros de 16 bytes con campos enteros que varían poco entre registros
+std::vector<unsigned char> binaryInput(int len) {
+    std::mt19937 rng(2);
+    std::vector<unsigned char> v(len);
+    int t = 0;
+    for (int i = 0; i + 16 <= len; i += 16) {
+        t += (int) (rng() % 16);
+        const int campos[4] = {t, (int) (rng() % 1000), 7, (int) (rng() % 3)};
+        for (int k = 0; k < 16; k++) {
+            v[i + k] = (unsigned char) (campos[k / 4] >> (8 * (k % 4)));
+        }
+    }
+    return v;
+}
+
+// len bytes uniformes: no se pueden comprimir
+std::vector<unsigned char> randomInput(int len) {
+    std::mt19937 rng(3);
+    std::vector<unsigned char> v(len);
+    for (unsigned char& b: v) {
+        b = (unsigned char) rng();
+    }
+    return v;
+}
+
+// contenido completo de un archivo (vacío si no se puede abrir)
+std::vector<unsigned char> fileInput(const char* path) {
+    std::vector<unsigned char> v;
+    FILE* f = fopen(path, "rb");
+    if (f != NULL) {
+        unsigned char buf[65536];
+        int n;
+        while ((n = (int) fread(buf, 1, sizeof(buf), f)) > 0) {
+            v.insert(v.end(), buf, buf + n);
+        }
+        fclose(f);
+    }
+    return v;
+}
+
+// segundos transcurridos desde t0
+double seconds(std::chrono::steady_clock::time_point t0) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
@@ -32,6 +32,9 @@ int add(T arr[], int &len, T e);
  * @param len Referencia a la longitud actual del array
  * @param e Elemento a insertar
  * @param p Posición donde insertar
+ *
+ * @note Los elementos se desplazan por movimiento; si T es trivialmente copiable
+ * el desplazamiento se hace con un único memmove.
  */
 template<typename T>
 void insert(T arr[], int &len, T e, int p);
@@ -42,10 +45,26 @@ void insert(T arr[], int &len, T e, int p);
  * @param len Referencia a la longitud actual del array
  * @param p Posición del elemento a remover
  * @return Elemento removido
+ *
+ * @note La posición arr[len - 1] queda con un valor movido (válido pero no especificado).
+ * Si T es trivialmente copiable el desplazamiento se hace con un único memmove.
  */
 template<typename T>
 T remove(T arr[], int &len, int p);
 
+/**
+ * @brief Remueve todos los elementos que cumplen una condición
+ * @param arr Array del cual remover los elementos
+ * @param len Referencia a la longitud actual del array
+ * @param pred Función que indica si un elemento debe removerse
+ * @return Cantidad de elementos removidos
+ *
+ * @note Compacta el array en una sola pasada conservando el orden de los elementos
+ * restantes. Las posiciones entre la nueva y la vieja longitud quedan con valores movidos.
+ */
+template<typename T>
+int removeIf(T arr[], int &len, bool pred(T));
+
 /**
  * @brief Busca un elemento en el array
  * @param arr Array donde buscar
@@ -57,6 +76,53 @@ T remove(T arr[], int &len, int p);
 template<typename T, typename K>
 int find(T arr[], int len, K k, int cmpTK(T, K));
 
+/**
+ * @brief Busca un elemento en el array por igualdad
+ * @param arr Array donde buscar
+ * @param len Longitud del array
+ * @param k Elemento a buscar
+ * @return Índice de la primera coincidencia o -1 si no se encuentra
+ *
+ * @note Dos elementos son iguales si ninguno es menor que el otro (el mismo criterio
+ * que cmpTT). Para tipos aritméticos en x86 compara varios elementos por instrucción
+ * con SSE2 o AVX2, elegidos en tiempo de ejecución.
+ */
+template<typename T>
+int find(T arr[], int len, T k);
+
+/**
+ * @brief Busca la primera posición cuyo elemento no es menor que la clave
+ * @param arr Array ordenado donde buscar
+ * @param len Longitud del array
+ * @param k Clave a buscar
+ * @param cmpTK Función de comparación
+ * @return Posición encontrada (len si todos los elementos son menores)
+ */
+template<typename T, typename K>
+int lowerBound(T arr[], int len, K k, int cmpTK(T, K));
+
+/**
+ * @brief Busca la primera posición cuyo elemento es mayor que la clave
+ * @param arr Array ordenado donde buscar
+ * @param len Longitud del array
+ * @param k Clave a buscar
+ * @param cmpTK Función de comparación
+ * @return Posición encontrada (len si ningún elemento es mayor)
+ */
+template<typename T, typename K>
+int upperBound(T arr[], int len, K k, int cmpTK(T, K));
+
+/**
+ * @brief Busca un elemento en un array ordenado usando búsqueda binaria
+ * @param arr Array ordenado donde buscar
+ * @param len Longitud del array
+ * @param k Clave del elemento a buscar
+ * @param cmpTK Función de comparación
+ * @return Índice de la primera coincidencia o -1 si no se encuentra
+ */
+template<typename T, typename K>
+int binaryFind(T arr[], int len, K k, int cmpTK(T, K));
+
 /**
  * @brief Inserta un elemento de forma ordenada en el array
  * @param arr Array donde insertar
@@ -64,17 +130,60 @@ int find(T arr[], int len, K k, int cmpTK(T, K));
  * @param e Elemento a insertar
  * @param cmpTT Función de comparación
  * @return Posición donde se insertó el elemento
+ *
+ * @note La posición se busca en O(log n) y se inserta antes de los elementos iguales.
  */
 template<typename T>
 int orderedInsert(T arr[], int &len, T e, int cmpTT(T, T));
 
 /**
- * @brief Ordena el array usando algoritmo burbuja
+ * @brief Ordena el array usando introsort
  * @param arr Array a ordenar
  * @param len Longitud del array
  * @param cmpTT Función de comparación
+ *
+ * @note Quicksort con mediana de tres que pasa a heapsort si la recursión se
+ * degrada y a inserción en particiones pequeñas. O(n log n), no es estable.
  */
 template<typename T>
 void sort(T arr[], int len, int cmpTT(T, T));
 
+/**
+ * @brief Ordena el array de forma estable usando merge sort
+ * @param arr Array a ordenar
+ * @param len Longitud del array
+ * @param cmpTT Función de comparación
+ *
+ * @note Los elementos iguales conservan su orden relativo, lo que permite ordenar
+ * por varias claves en pasadas sucesivas. O(n log n) con un buffer auxiliar de len elementos.
+ */
+template<typename T>
+void stableSort(T arr[], int len, int cmpTT(T, T));
+
+/**
+ * @brief Ordena el array de forma estable con un comparador arbitrario
+ * @param arr Array a ordenar
+ * @param len Longitud del array
+ * @param cmpTT Objeto invocable como cmpTT(a, b) que retorna negativo, 0 o positivo
+ *
+ * @note Igual que stableSort, pero acepta lambdas con captura u objetos función,
+ * útil para ordenar registros auxiliares sin pasar por una función global.
+ */
+template<typename T, typename Cmp>
+void stableSortBy(T arr[], int len, Cmp cmpTT);
+
+/**
+ * @brief Ordena el array repartiendo el trabajo entre varios hilos
+ * @param arr Array a ordenar
+ * @param len Longitud del array
+ * @param cmpTT Función de comparación
+ * @param threads Cantidad de hilos (si es menor o igual a 0 se usan los núcleos disponibles)
+ *
+ * @note Merge sort paralelo: cada hilo ordena un bloque y luego los bloques se
+ * combinan por pares, dividiendo cada merge entre hilos. El resultado es estable y
+ * coincide con el de stableSort. Requiere compilar con -pthread.
+ */
+template<typename T>
+void parallelSort(T arr[], int len, int cmpTT(T, T), int threads);
+
 #endif //ARRAYS_H
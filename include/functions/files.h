@@ -31,13 +31,39 @@ void write(FILE *f, T t);
 template<typename T>
 T read(FILE *f);
 
+/**
+ * @brief Escribe un bloque de registros consecutivos en un archivo
+ * @param f Puntero al archivo
+ * @param arr Array con los registros a escribir
+ * @param n Cantidad de registros
+ * @return Cantidad de registros escritos (menor que n si hubo un error)
+ */
+template<typename T>
+int writeBlock(FILE *f, const T arr[], int n);
+
+/**
+ * @brief Lee un bloque de registros consecutivos del archivo
+ * @param f Puntero al archivo
+ * @param arr Array donde se guardan los registros leídos
+ * @param n Cantidad máxima de registros a leer
+ * @return Cantidad de registros leídos (menor que n si se alcanza el fin del archivo)
+ */
+template<typename T>
+int readBlock(FILE *f, T arr[], int n);
+
 /**
  * @brief Establece la posición del archivo en un determinado registro
  * @param f Puntero al archivo
  * @param n Número de registro
+ * @return true si se pudo posicionar el archivo
+ *
+ * @note El desplazamiento se calcula en 64 bits (fseeko en POSIX, _fseeki64 en Windows),
+ * así que admite archivos de más de 2 GiB aunque long sea de 32 bits. En sistemas POSIX
+ * de 32 bits hay que compilar con -D_FILE_OFFSET_BITS=64. fileSize y filePos también
+ * leen la posición en 64 bits.
  */
 template<typename T>
-void seek(FILE *f, int n);
+bool seek(FILE *f, long long n);
 
 /**
  * @brief Retorna la cantidad de registros de un archivo
@@ -55,4 +81,34 @@ int fileSize(FILE *f);
 template<typename T>
 int filePos(FILE *f);
 
+/**
+ * @brief Archivo proyectado en memoria
+ */
+struct FileMap
+{
+    unsigned char* data;  ///< Contenido del archivo (NULL si no se pudo proyectar)
+    long len;             ///< Tamaño en bytes
+    bool escritura;       ///< Indica si los cambios se guardan en el archivo
+};
+
+/**
+ * @brief Proyecta un archivo completo en memoria
+ * @param path Ruta del archivo
+ * @param escritura Si es true, el archivo se crea si no existe, se lleva a len bytes y
+ * los cambios en data se guardan en él; si es false, se proyecta sólo para lectura
+ * @param len Tamaño del archivo al abrirlo para escritura (se ignora en lectura)
+ * @return Proyección del archivo; data es NULL si no se pudo proyectar
+ *
+ * @note Usa mmap, por lo que sólo está disponible en sistemas POSIX; en otros
+ * sistemas data es siempre NULL. Un archivo de 0 bytes se proyecta con éxito: data no
+ * es NULL pero no debe leerse, y len es 0.
+ */
+FileMap fileMap(const char* path, bool escritura, long len);
+
+/**
+ * @brief Sincroniza y cierra una proyección creada con fileMap
+ * @param m Referencia a la proyección
+ */
+void fileUnmap(FileMap& m);
+
 #endif //FILES_H
@@ -14,6 +14,7 @@
 #define TOKENS_H
 
 #include <string>
+#include <string_view>
 
 /**
  * @brief Cuenta la cantidad de tokens en una cadena tokenizada
@@ -21,7 +22,7 @@
  * @param sep Carácter separador
  * @return Cantidad de tokens
  */
-int tokenCount(std::string s, char sep);
+int tokenCount(const std::string &s, char sep);
 
 /**
  * @brief Añade un token a una cadena tokenizada
@@ -38,7 +39,18 @@ void addToken(std::string &s, char sep, const std::string &t);
  * @param i Índice del token
  * @return Token en la posición especificada
  */
-std::string getTokenAt(std::string s, char sep, int i);
+std::string getTokenAt(const std::string &s, char sep, int i);
+
+/**
+ * @brief Devuelve una vista a un token de una cadena tokenizada, sin copiarlo
+ * @param s Cadena tokenizada
+ * @param sep Carácter separador
+ * @param i Índice del token
+ * @return Vista al token en la posición especificada (vacía si no existe)
+ *
+ * @warning La vista referencia a s: deja de ser válida si s se modifica o se destruye.
+ */
+std::string_view getTokenViewAt(std::string_view s, char sep, int i);
 
 /**
  * @brief Remueve un token en una cadena tokenizada
@@ -55,7 +67,7 @@ void removeTokenAt(std::string &s, char sep, int i);
  * @param t Nuevo token
  * @param i Índice del token a reemplazar
  */
-void setTokenAt(std::string &s, char sep, std::string t, int i);
+void setTokenAt(std::string &s, char sep, const std::string &t, int i);
 
 /**
  * @brief Indica el número de token en una cadena tokenizada
@@ -64,7 +76,7 @@ void setTokenAt(std::string &s, char sep, std::string t, int i);
  * @param t Token a buscar
  * @return Índice del token encontrado o -1 si no se encuentra
  */
-int findToken(std::string s, char sep, std::string t);
+int findToken(const std::string &s, char sep, const std::string &t);
 
 /**
  * @brief Crea una cadena tokenizada vacía con tokens en blanco
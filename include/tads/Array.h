@@ -13,9 +13,23 @@
 #ifndef ARRAY_H
 #define ARRAY_H
 
+/**
+ * @brief Factor de crecimiento geométrico de la capacidad del array
+ *
+ * Cada vez que el array se llena su capacidad se multiplica por este factor,
+ * con lo que agregar al final tiene costo amortizado O(1). Puede redefinirse
+ * antes de incluir este archivo (debe ser mayor que 1).
+ */
+#ifndef ARRAY_GROWTH_FACTOR
+#define ARRAY_GROWTH_FACTOR 2.0
+#endif
+
 /**
  * @brief Estructura de array dinámico
  * @tparam T Tipo de datos a almacenar
+ *
+ * Las posiciones entre len y cap son memoria sin inicializar: los elementos se
+ * construyen recién al agregarse y se destruyen al removerse.
  */
 template<typename T>
 struct Array
@@ -36,13 +50,50 @@ template<typename T>
 Array<T> arrayCreate();
 
 /**
- * @brief Redimensiona el array aumentando su capacidad en 1
+ * @brief Redimensiona el array multiplicando su capacidad por ARRAY_GROWTH_FACTOR
  * @tparam T Tipo de datos del array
  * @param a Referencia al array a redimensionar
  */
 template<typename T>
 void redimensionar(Array<T>& a);
 
+/**
+ * @brief Redimensiona el array a una capacidad exacta
+ * @tparam T Tipo de datos del array
+ * @param a Referencia al array a redimensionar
+ * @param cap Nueva capacidad (no menor que la longitud actual)
+ */
+template<typename T>
+void redimensionar(Array<T>& a, int cap);
+
+/**
+ * @brief Reserva capacidad para al menos n elementos
+ * @tparam T Tipo de datos del array
+ * @param a Referencia al array
+ * @param n Capacidad mínima requerida
+ *
+ * @note Si la capacidad actual ya alcanza, no hace nada.
+ */
+template<typename T>
+void arrayReserve(Array<T>& a, int n);
+
+/**
+ * @brief Reduce la capacidad del array a su longitud actual
+ * @tparam T Tipo de datos del array
+ * @param a Referencia al array
+ */
+template<typename T>
+void arrayShrinkToFit(Array<T>& a);
+
+/**
+ * @brief Retorna la capacidad actual del array
+ * @tparam T Tipo de datos del array
+ * @param a Array del cual obtener la capacidad
+ * @return Cantidad de elementos que entran sin redimensionar
+ */
+template<typename T>
+int arrayCapacity(Array<T> a);
+
 /**
  * @brief Agrega un elemento al final del array
  * @tparam T Tipo de datos del array
@@ -53,6 +104,43 @@ void redimensionar(Array<T>& a);
 template<typename T>
 int arrayAdd(Array<T>& a, T t);
 
+/**
+ * @brief Agrega al final del array los elementos de un buffer
+ * @tparam T Tipo de datos del array
+ * @param a Referencia al array
+ * @param arr Buffer con los elementos a agregar
+ * @param n Cantidad de elementos del buffer
+ * @return Índice del primer elemento agregado
+ *
+ * @note Redimensiona a lo sumo una vez. El buffer puede pertenecer al propio array
+ * (por ejemplo arrayAddAll(a, a.arr, a.len)): en ese caso se copia antes de crecer.
+ */
+template<typename T>
+int arrayAddAll(Array<T>& a, const T* arr, int n);
+
+/**
+ * @brief Agrega al final del array todos los elementos de otro array
+ * @tparam T Tipo de datos del array
+ * @param a Referencia al array destino
+ * @param b Array cuyos elementos se agregan
+ * @return Índice del primer elemento agregado
+ */
+template<typename T>
+int arrayAddAll(Array<T>& a, Array<T> b);
+
+/**
+ * @brief Construye un elemento al final del array a partir de sus argumentos
+ * @tparam T Tipo de datos del array
+ * @tparam Args Tipos de los argumentos del constructor de T
+ * @param a Referencia al array
+ * @param args Argumentos que se pasan al constructor de T
+ * @return Índice del elemento agregado
+ *
+ * @note El elemento se construye directamente en el array, sin copias intermedias.
+ */
+template<typename T, typename... Args>
+int arrayEmplace(Array<T>& a, Args&&... args);
+
 /**
  * @brief Obtiene un puntero al elemento en la posición especificada
  * @tparam T Tipo de datos del array
@@ -83,6 +171,20 @@ void arraySet(Array<T>& a, int p, T t);
 template<typename T>
 void arrayInsert(Array<T>& a, T t, int p);
 
+/**
+ * @brief Inserta los elementos de un buffer a partir de la posición especificada
+ * @tparam T Tipo de datos del array
+ * @param a Referencia al array
+ * @param arr Buffer con los elementos a insertar
+ * @param n Cantidad de elementos del buffer
+ * @param p Posición donde insertar el primer elemento
+ *
+ * @note Desplaza el resto del array una sola vez. El buffer puede pertenecer al propio
+ * array: en ese caso se copia antes de crecer y de abrir el hueco.
+ */
+template<typename T>
+void arrayInsertRange(Array<T>& a, const T* arr, int n, int p);
+
 /**
  * @brief Retorna el tamaño actual del array
  * @tparam T Tipo de datos del array
@@ -102,6 +204,18 @@ int arraySize(Array<T> a);
 template<typename T>
 T arrayRemove(Array<T>& a, int p);
 
+/**
+ * @brief Remueve todos los elementos que cumplen una condición
+ * @tparam T Tipo de datos del array
+ * @param a Referencia al array
+ * @param pred Función que retorna true para los elementos a remover
+ * @return Cantidad de elementos removidos
+ *
+ * @note Recorre el array una sola vez y conserva el orden de los elementos restantes.
+ */
+template<typename T>
+int arrayRemoveIf(Array<T>& a, bool pred(T));
+
 /**
  * @brief Remueve todos los elementos del array
  * @tparam T Tipo de datos del array
@@ -122,6 +236,54 @@ void arrayRemoveAll(Array<T>& a);
 template<typename T, typename K>
 int arrayFind(Array<T> a, K k, int cmpTK(T, K));
 
+/**
+ * @brief Busca un elemento en el array por igualdad
+ * @tparam T Tipo de datos del array
+ * @param a Array en el cual buscar
+ * @param k Elemento a buscar
+ * @return Índice del elemento encontrado o -1 si no se encuentra
+ *
+ * @note Equivale a arrayFind con cmpTT, pero para tipos aritméticos usa instrucciones SIMD.
+ */
+template<typename T>
+int arrayFind(Array<T> a, T k);
+
+/**
+ * @brief Busca un elemento en un array ordenado usando búsqueda binaria
+ * @tparam T Tipo de datos del array
+ * @tparam K Tipo de la clave de búsqueda
+ * @param a Array ordenado en el cual buscar
+ * @param k Clave a buscar
+ * @param cmpTK Función de comparación entre T y K (la misma usada para ordenar)
+ * @return Índice de la primera coincidencia o -1 si no se encuentra
+ */
+template<typename T, typename K>
+int arrayBinaryFind(Array<T> a, K k, int cmpTK(T, K));
+
+/**
+ * @brief Busca la primera posición del array ordenado cuyo elemento no es menor que la clave
+ * @tparam T Tipo de datos del array
+ * @tparam K Tipo de la clave de búsqueda
+ * @param a Array ordenado en el cual buscar
+ * @param k Clave a buscar
+ * @param cmpTK Función de comparación entre T y K
+ * @return Posición encontrada (arraySize si todos los elementos son menores)
+ */
+template<typename T, typename K>
+int arrayLowerBound(Array<T> a, K k, int cmpTK(T, K));
+
+/**
+ * @brief Busca la primera posición del array ordenado cuyo elemento es mayor que la clave
+ * @tparam T Tipo de datos del array
+ * @tparam K Tipo de la clave de búsqueda
+ * @param a Array ordenado en el cual buscar
+ * @param k Clave a buscar
+ * @param cmpTK Función de comparación entre T y K
+ * @return Posición encontrada (arraySize si ningún elemento es mayor)
+ */
+template<typename T, typename K>
+int arrayUpperBound(Array<T> a, K k, int cmpTK(T, K));
+
 /**
  * @brief Inserta un elemento manteniendo el orden del array
  * @tparam T Tipo de datos del array
@@ -129,6 +291,8 @@ int arrayFind(Array<T> a, K k, int cmpTK(T, K));
  * @param t Elemento a insertar
  * @param cmpTT Función de comparación entre elementos T
  * @return Índice donde se insertó el elemento
+ *
+ * @note La posición se busca con búsqueda binaria.
  */
 template<typename T>
 int arrayOrderedInsert(Array<T>& a, T t, int cmpTT(T, T));
@@ -153,6 +317,29 @@ T* arrayDiscover(Array<T>& a, T t, int cmpTT(T, T));
 template<typename T>
 void arraySort(Array<T>& a, int cmpTT(T, T));
 
+/**
+ * @brief Ordena el array de forma estable usando una función de comparación
+ * @tparam T Tipo de datos del array
+ * @param a Referencia al array
+ * @param cmpTT Función de comparación entre elementos T
+ *
+ * @note Los elementos iguales conservan su orden relativo.
+ */
+template<typename T>
+void arrayStableSort(Array<T>& a, int cmpTT(T, T));
+
+/**
+ * @brief Ordena el array usando varios hilos
+ * @tparam T Tipo de datos del array
+ * @param a Referencia al array
+ * @param cmpTT Función de comparación entre elementos T
+ * @param threads Cantidad de hilos (si es menor o igual a 0 se usan los núcleos disponibles)
+ *
+ * @note Deja el array en el mismo orden que arrayStableSort. Requiere compilar con -pthread.
+ */
+template<typename T>
+void arrayParallelSort(Array<T>& a, int cmpTT(T, T), int threads);
+
 /**
  * @brief Muestra todos los elementos del array en la salida estándar
  * @tparam T Tipo de datos del array
@@ -6,23 +6,44 @@
  * @date 2023
  *
  * Esta biblioteca proporciona funciones para la lectura de archivos a nivel de bit,
- * permitiendo extraer bits individuales de archivos binarios y convertir tipos
+ * permitiendo extraer bits individuales o grupos de hasta 57 bits de archivos binarios
+ * o de un bloque de memoria (por ejemplo, uno obtenido con fileMap) y convertir tipos
  * de datos a su representación binaria en formato string.
+ * Los bits se leen desde el más significativo de cada byte.
  */
 
 #ifndef BITREADER_H
 #define BITREADER_H
 
+#include <cstdint>
 #include <iostream>
+#include <vector>
+
+/**
+ * @brief Tamaño en bytes del buffer de lectura del archivo
+ */
+#ifndef BITREADER_BUFFER
+#define BITREADER_BUFFER 65536
+#endif
 
 /**
  * @brief Estructura para lectura de archivos bit a bit
+ *
+ * El archivo se lee en bloques de BITREADER_BUFFER bytes y los bits pendientes se
+ * mantienen alineados a la izquierda en un acumulador de 64 bits. Si la fuente es un
+ * bloque de memoria los bytes se toman de él directamente, sin copias ni llamadas al
+ * sistema.
  */
 struct BitReader
 {
-   FILE* f;  ///< Puntero al archivo a leer
-   int buf;  ///< Buffer para almacenar el byte actual
-   int pos;  ///< Posición actual dentro del byte (0-7)
+   FILE* f;                         ///< Puntero al archivo a leer (NULL si la fuente es memoria)
+   const unsigned char* mem;        ///< Bloque de memoria a leer (NULL si la fuente es un archivo)
+   std::vector<unsigned char> buf;  ///< Bytes leídos del archivo y aún no cargados al acumulador
+   long long off;                   ///< Próximo byte de buf (o de mem) a cargar
+   long long len;                   ///< Cantidad de bytes válidos en buf (o en mem)
+   bool fin;                        ///< Indica que la fuente ya no tiene más bytes
+   uint64_t acc;                    ///< Acumulador: el próximo bit es el más significativo
+   int nbits;                       ///< Cantidad de bits válidos en el acumulador
 };
 
 /**
@@ -32,11 +53,51 @@ struct BitReader
  */
 BitReader bitReader(FILE* f);
 
+/**
+ * @brief Crea un nuevo BitReader que lee de un bloque de memoria
+ * @param data Bytes a leer; deben seguir vigentes mientras se use el BitReader
+ * @param len Cantidad de bytes (en 64 bits, así admite un FileMap de más de 2 GiB)
+ * @return BitReader inicializado
+ */
+BitReader bitReader(const unsigned char* data, long long len);
+
 /**
  * @brief Lee el siguiente bit del archivo
  * @param br Referencia al BitReader
- * @return Valor del bit leído (0 o 1)
+ * @return Valor del bit leído (0 o 1), o 0 si se alcanzó el fin del archivo
  */
 int bitReaderRead(BitReader& br);
 
-#endif //BITREADER_H
\ No newline at end of file
+/**
+ * @brief Consulta los próximos n bits sin consumirlos
+ * @param br Referencia al BitReader
+ * @param n Cantidad de bits (entre 0 y 57)
+ * @return Los n bits como entero, el primero en la posición más significativa.
+ * Los bits posteriores al fin del archivo valen 0.
+ */
+uint64_t bitReaderPeekBits(BitReader& br, int n);
+
+/**
+ * @brief Descarta los próximos n bits
+ * @param br Referencia al BitReader
+ * @param n Cantidad de bits a descartar (cualquier valor no negativo)
+ */
+void bitReaderSkipBits(BitReader& br, int n);
+
+/**
+ * @brief Lee los próximos n bits
+ * @param br Referencia al BitReader
+ * @param n Cantidad de bits (entre 0 y 57)
+ * @return Los n bits como entero, el primero en la posición más significativa.
+ * Los bits posteriores al fin del archivo valen 0.
+ */
+uint64_t bitReaderReadBits(BitReader& br, int n);
+
+/**
+ * @brief Indica si ya se consumieron todos los bits del archivo
+ * @param br Referencia al BitReader
+ * @return true si no quedan bits por leer
+ */
+bool bitReaderEof(BitReader& br);
+
+#endif //BITREADER_H
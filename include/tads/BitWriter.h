@@ -6,23 +6,44 @@
  * @date 2023
  *
  * Esta biblioteca proporciona funciones para la escritura de archivos a nivel de bit,
- * permitiendo escribir bits individuales o cadenas de bits en archivos binarios
- * con buffering automático y flush para completar bytes parciales.
+ * permitiendo escribir bits individuales, cadenas de bits o grupos de hasta 64 bits en
+ * archivos binarios o en memoria (un buffer que crece o un bloque provisto por quien
+ * llama, por ejemplo uno obtenido con fileMap), con buffering automático y flush para
+ * completar bytes parciales.
+ * Los bits se escriben desde el más significativo de cada byte.
  */
 
 #ifndef BITWRITER_H
 #define BITWRITER_H
 
+#include <cstdint>
 #include <iostream>
+#include <vector>
+
+/**
+ * @brief Tamaño en bytes del buffer que se vuelca al archivo en un solo bloque
+ */
+#ifndef BITWRITER_BUFFER
+#define BITWRITER_BUFFER 65536
+#endif
 
 /**
  * @brief Estructura para escritura de archivos bit a bit
+ *
+ * Los bits se acumulan en un entero de 64 bits; cada byte completo pasa a un buffer
+ * que se escribe al final del archivo cuando se llena o al hacer flush. Sin archivo, el
+ * buffer crece y es la salida; con un bloque de memoria, los bytes se escriben
+ * directamente en él.
  */
 struct BitWriter
 {
-    FILE* f;    ///< Puntero al archivo donde escribir
-    std::string s;   ///< Buffer de bits pendientes de escribir
-    int pos;    ///< Posición actual en el buffer
+    FILE* f;                         ///< Puntero al archivo donde escribir (NULL si el destino es memoria)
+    unsigned char* mem;              ///< Bloque de memoria destino (NULL si se usa buf)
+    std::vector<unsigned char> buf;  ///< Bytes completos pendientes de escribir, o la salida si no hay archivo
+    int len;                         ///< Cantidad de bytes escritos en buf (o en mem)
+    int cap;                         ///< Capacidad del destino actual (buf o mem)
+    uint64_t acc;                    ///< Acumulador: los bits pendientes son los nbits menos significativos
+    int nbits;                       ///< Cantidad de bits pendientes en el acumulador (0-7)
 };
 
 /**
@@ -32,6 +53,40 @@ struct BitWriter
  */
 BitWriter bitWriter(FILE* f);
 
+/**
+ * @brief Crea un nuevo BitWriter que escribe en un buffer propio que crece a demanda
+ * @return BitWriter inicializado
+ */
+BitWriter bitWriter();
+
+/**
+ * @brief Crea un nuevo BitWriter que escribe en un bloque de memoria provisto por quien llama
+ * @param data Bloque destino; debe seguir vigente mientras se use el BitWriter
+ * @param cap Capacidad del bloque en bytes
+ * @return BitWriter inicializado
+ *
+ * @note Los bytes que no entran en el bloque se descartan, pero se siguen contando en
+ * bitWriterSize: un tamaño mayor que cap indica que la salida quedó truncada. Un
+ * FileMap de más de INT_MAX bytes debe escribirse por tramos de a lo sumo INT_MAX.
+ */
+BitWriter bitWriter(unsigned char* data, int cap);
+
+/**
+ * @brief Retorna los bytes escritos en memoria
+ * @param bw Referencia al BitWriter
+ * @return Puntero al inicio de la salida (el buffer propio o el bloque provisto)
+ *
+ * @note Con destino en memoria, llamar antes a bitWriterFlush para incluir el último byte parcial.
+ */
+const unsigned char* bitWriterData(const BitWriter& bw);
+
+/**
+ * @brief Retorna la cantidad de bytes completos escritos en memoria
+ * @param bw Referencia al BitWriter
+ * @return Cantidad de bytes (con un archivo, sólo los pendientes de volcar)
+ */
+int bitWriterSize(const BitWriter& bw);
+
 /**
  * @brief Escribe un bit individual al buffer
  * @param bw Referencia al BitWriter
@@ -46,10 +101,18 @@ void bitWriterWrite(BitWriter& bw, int bit);
  */
 void bitWriterWrite(BitWriter& bw, const std::string &sbit);
 
+/**
+ * @brief Escribe los n bits menos significativos de un valor
+ * @param bw Referencia al BitWriter
+ * @param value Valor cuyos bits se escriben, desde el bit n-1 hasta el 0
+ * @param n Cantidad de bits (entre 0 y 64)
+ */
+void bitWriterWriteBits(BitWriter& bw, uint64_t value, int n);
+
 /**
  * @brief Vuelca el buffer al archivo completando bytes parciales con ceros
  * @param bw Referencia al BitWriter
  */
 void bitWriterFlush(BitWriter& bw);
 
-#endif //BITWRITER_H
\ No newline at end of file
+#endif //BITWRITER_H
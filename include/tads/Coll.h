@@ -8,23 +8,48 @@
  * Esta biblioteca proporciona una estructura de datos Coll que almacena elementos
  * de cualquier tipo como tokens separados por un delimitador en un std::string.
  * Incluye funciones para inserción, eliminación, búsqueda, ordenamiento e iteración.
+ * El ordenamiento usa stableSortBy de functions/arrays.h, por lo que hay que incluir
+ * también arrays.cpp junto con la implementación de este archivo.
  */
 
 #ifndef COLL_H
 #define COLL_H
 
 #include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Backend textual: los elementos se guardan como tokens separados (por defecto)
+ */
+struct CollText {};
+
+/**
+ * @brief Backend binario: los elementos se guardan como registros binarios
+ */
+struct CollBinary {};
 
 /**
  * @brief Estructura de colección basada en std::string con separadores
  * @tparam T Tipo de datos a almacenar
+ * @tparam B Backend de almacenamiento (CollText o CollBinary)
+ *
+ * La colección mantiene un índice con la posición de cada separador dentro de s,
+ * que se construye la primera vez que se necesita y se actualiza en cada
+ * modificación. Con él, el acceso por posición, el tamaño y la iteración son O(1).
+ *
+ * @note Si s se modifica directamente hay que asignar idxLen = -1 para que el índice
+ * se reconstruya; un cambio que conserve la longitud de s no se detecta solo.
  */
-template<typename T>
+template<typename T, typename B = CollText>
 struct Coll
 {
    std::string s;   ///< String que contiene todos los elementos separados
    char sep;   ///< Carácter separador entre elementos
    int pos;    ///< Posición actual para iteración
+   mutable std::vector<int> seps; ///< Posiciones de los separadores dentro de s
+   mutable int idxLen = -1; ///< Longitud de s al construir el índice (-1 si no es válido)
 };
 
 /**
@@ -51,7 +76,7 @@ Coll<T> coll();
  * @return Cantidad de elementos
  */
 template<typename T>
-int collSize(Coll<T> c);
+int collSize(const Coll<T>& c);
 
 /**
  * @brief Remueve todos los elementos de la colección
@@ -101,7 +126,7 @@ void collSetAt(Coll<T>& c, T t, int p, std::string tToString(T));
  * @return Elemento en la posición especificada
  */
 template<typename T>
-T collGetAt(Coll<T> c, int p, T tFromString(std::string));
+T collGetAt(const Coll<T>& c, int p, T tFromString(std::string));
 
 /**
  * @brief Busca un elemento en la colección usando una función de comparación
@@ -114,7 +139,7 @@ T collGetAt(Coll<T> c, int p, T tFromString(std::string));
  * @return Índice del elemento encontrado o -1 si no se encuentra
  */
 template<typename T, typename K>
-int collFind(Coll<T> c, K k, int cmpTK(T, K), T tFromString(std::string));
+int collFind(const Coll<T>& c, K k, int cmpTK(T, K), T tFromString(std::string));
 
 /**
  * @brief Ordena la colección usando una función de comparación
@@ -123,10 +148,45 @@ int collFind(Coll<T> c, K k, int cmpTK(T, K), T tFromString(std::string));
  * @param cmpTT Función de comparación entre elementos T
  * @param tFromString Función para convertir std::string a T
  * @param tToString Función para convertir T a std::string
+ *
+ * @note Decodifica cada elemento una sola vez, los ordena con merge sort (O(n log n))
+ * y vuelve a codificarlos una sola vez. Es estable, como el ordenamiento original: los
+ * elementos iguales conservan su orden relativo.
  */
 template<typename T>
 void collSort(Coll<T>& c, int cmpTT(T, T), T tFromString(std::string), std::string tToString(T));
 
+/**
+ * @brief Ordena la colección de forma estable usando una función de comparación
+ * @tparam T Tipo de datos de la colección
+ * @tparam B Backend de almacenamiento de la colección
+ * @param c Referencia a la colección
+ * @param cmpTT Función de comparación entre elementos T
+ * @param tFromString Función para convertir std::string a T
+ * @param tToString Función para convertir T a std::string
+ *
+ * @note Los elementos iguales conservan su orden relativo (merge sort, O(n log n)).
+ */
+template<typename T, typename B>
+void collStableSort(Coll<T, B>& c, int cmpTT(T, T), T tFromString(std::string), std::string tToString(T));
+
+/**
+ * @brief Ordena la colección de forma estable según una clave extraída de cada elemento
+ * @tparam T Tipo de datos de la colección
+ * @tparam K Tipo de la clave de ordenamiento
+ * @tparam B Backend de almacenamiento de la colección
+ * @param c Referencia a la colección
+ * @param key Función que extrae la clave de un elemento
+ * @param cmpKK Función de comparación entre claves
+ * @param tFromString Función para convertir std::string a T
+ * @param tToString Función para convertir T a std::string
+ *
+ * @note La clave de cada elemento se calcula una sola vez y las comparaciones se
+ * hacen sobre las claves guardadas. Útil cuando extraer o comparar T es costoso.
+ */
+template<typename T, typename K, typename B>
+void collSortByKey(Coll<T, B>& c, K key(T), int cmpKK(K, K), T tFromString(std::string), std::string tToString(T));
+
 /**
  * @brief Verifica si hay más elementos para iterar
  * @tparam T Tipo de datos de la colección
@@ -134,7 +194,7 @@ void collSort(Coll<T>& c, int cmpTT(T, T), T tFromString(std::string), std::stri
  * @return true si hay más elementos, false en caso contrario
  */
 template<typename T>
-bool collHasNext(Coll<T> c);
+bool collHasNext(const Coll<T>& c);
 
 /**
  * @brief Obtiene el siguiente elemento en la iteración
@@ -169,9 +229,226 @@ void collReset(Coll<T>& c);
  * @brief Convierte la colección a su representación std::string
  * @tparam T Tipo de datos de la colección
  * @param c Colección a convertir
- * @return String que representa la colección
+ * @return Referencia al string que representa la colección (sin copiarlo)
+ */
+template<typename T>
+const std::string& collToString(const Coll<T>& c);
+
+/**
+ * @brief Cursor de lectura secuencial sobre una colección
+ * @tparam T Tipo de datos de la colección
+ *
+ * Guarda el desplazamiento en bytes del próximo token dentro del string de la
+ * colección, por lo que cada avance cuesta O(longitud del token) y un recorrido
+ * completo es lineal, sin usar ni construir el índice de separadores.
+ *
+ * @warning El cursor referencia al string de la colección: deja de ser válido si la
+ * colección se modifica o se destruye.
+ */
+template<typename T>
+struct CollCursor
+{
+   std::string_view s; ///< Vista al string de la colección
+   char sep;           ///< Carácter separador entre elementos
+   int off;            ///< Desplazamiento en bytes del próximo token
+};
+
+/**
+ * @brief Crea un cursor posicionado en el primer elemento de la colección
+ * @tparam T Tipo de datos de la colección
+ * @param c Colección a recorrer
+ * @return Cursor inicializado
+ */
+template<typename T>
+CollCursor<T> collCursor(const Coll<T>& c);
+
+/**
+ * @brief Verifica si el cursor tiene más elementos para leer
+ * @tparam T Tipo de datos de la colección
+ * @param cur Cursor a verificar
+ * @return true si hay más elementos, false en caso contrario
+ */
+template<typename T>
+bool collCursorHasNext(const CollCursor<T>& cur);
+
+/**
+ * @brief Obtiene el siguiente token sin convertirlo ni copiarlo
+ * @tparam T Tipo de datos de la colección
+ * @param cur Referencia al cursor
+ * @return Vista al token dentro del string de la colección
+ */
+template<typename T>
+std::string_view collCursorNextToken(CollCursor<T>& cur);
+
+/**
+ * @brief Obtiene el siguiente elemento convertido a T
+ * @tparam T Tipo de datos de la colección
+ * @param cur Referencia al cursor
+ * @param tFromString Función para convertir std::string a T
+ * @return Siguiente elemento
+ */
+template<typename T>
+T collCursorNext(CollCursor<T>& cur, T tFromString(std::string));
+
+/**
+ * @brief Colección con almacenamiento binario
+ * @tparam T Tipo de datos a almacenar
+ *
+ * Si T es trivialmente copiable cada elemento ocupa un registro de sizeof(T) bytes
+ * y se lee y escribe con memcpy, sin pasar por tToString/tFromString (que se ignoran).
+ * Los demás tipos se guardan como registros de longitud variable: un entero de 32 bits
+ * con la longitud seguido de los bytes de tToString(t). Como no hay separadores, los
+ * elementos pueden contener cualquier carácter.
+ */
+template<typename T>
+struct Coll<T, CollBinary>
+{
+   std::string s;         ///< Bytes de todos los registros, uno a continuación del otro
+   int pos;               ///< Posición actual para iteración
+   std::vector<int> offs; ///< Inicio de cada registro (sólo para registros de longitud variable)
+};
+
+/**
+ * @brief Crea una nueva colección con el backend especificado
+ * @tparam T Tipo de datos de la colección
+ * @tparam B Backend de almacenamiento (actualmente sólo CollBinary)
+ * @return Colección inicializada
+ *
+ * @note Uso: Coll<int, CollBinary> c = coll<int, CollBinary>();
+ */
+template<typename T, typename B>
+Coll<T, B> coll();
+
+/**
+ * @brief Retorna el número de elementos en la colección binaria
+ * @tparam T Tipo de datos de la colección
+ * @param c Colección a consultar
+ * @return Cantidad de elementos
+ */
+template<typename T>
+int collSize(const Coll<T, CollBinary>& c);
+
+/**
+ * @brief Remueve todos los elementos de la colección binaria
+ * @tparam T Tipo de datos de la colección
+ * @param c Referencia a la colección
+ */
+template<typename T>
+void collRemoveAll(Coll<T, CollBinary>& c);
+
+/**
+ * @brief Remueve el elemento en la posición especificada de la colección binaria
+ * @tparam T Tipo de datos de la colección
+ * @param c Referencia a la colección
+ * @param p Posición del elemento a remover
+ */
+template<typename T>
+void collRemoveAt(Coll<T, CollBinary>& c, int p);
+
+/**
+ * @brief Agrega un elemento al final de la colección binaria
+ * @tparam T Tipo de datos de la colección
+ * @param c Referencia a la colección
+ * @param t Elemento a agregar
+ * @param tToString Función para convertir T a std::string (no se usa si T es trivialmente copiable)
+ * @return Índice del elemento agregado
+ */
+template<typename T>
+int collAdd(Coll<T, CollBinary>& c, T t, std::string tToString(T));
+
+/**
+ * @brief Establece el valor de un elemento de la colección binaria
+ * @tparam T Tipo de datos de la colección
+ * @param c Referencia a la colección
+ * @param t Nuevo valor del elemento
+ * @param p Posición del elemento
+ * @param tToString Función para convertir T a std::string (no se usa si T es trivialmente copiable)
+ */
+template<typename T>
+void collSetAt(Coll<T, CollBinary>& c, T t, int p, std::string tToString(T));
+
+/**
+ * @brief Obtiene el elemento en la posición especificada de la colección binaria
+ * @tparam T Tipo de datos de la colección
+ * @param c Colección de la cual obtener el elemento
+ * @param p Posición del elemento
+ * @param tFromString Función para convertir std::string a T (no se usa si T es trivialmente copiable)
+ * @return Elemento en la posición especificada
+ */
+template<typename T>
+T collGetAt(const Coll<T, CollBinary>& c, int p, T tFromString(std::string));
+
+/**
+ * @brief Busca un elemento en la colección binaria usando una función de comparación
+ * @tparam T Tipo de datos de la colección
+ * @tparam K Tipo de la clave de búsqueda
+ * @param c Colección en la cual buscar
+ * @param k Clave a buscar
+ * @param cmpTK Función de comparación entre T y K
+ * @param tFromString Función para convertir std::string a T (no se usa si T es trivialmente copiable)
+ * @return Índice del elemento encontrado o -1 si no se encuentra
+ */
+template<typename T, typename K>
+int collFind(const Coll<T, CollBinary>& c, K k, int cmpTK(T, K), T tFromString(std::string));
+
+/**
+ * @brief Ordena la colección binaria usando una función de comparación
+ * @tparam T Tipo de datos de la colección
+ * @param c Referencia a la colección
+ * @param cmpTT Función de comparación entre elementos T
+ * @param tFromString Función para convertir std::string a T (no se usa si T es trivialmente copiable)
+ * @param tToString Función para convertir T a std::string (no se usa si T es trivialmente copiable)
+ *
+ * @note Es estable, igual que collSort sobre la colección de texto.
+ */
+template<typename T>
+void collSort(Coll<T, CollBinary>& c, int cmpTT(T, T), T tFromString(std::string), std::string tToString(T));
+
+/**
+ * @brief Verifica si hay más elementos para iterar en la colección binaria
+ * @tparam T Tipo de datos de la colección
+ * @param c Colección a verificar
+ * @return true si hay más elementos, false en caso contrario
+ */
+template<typename T>
+bool collHasNext(const Coll<T, CollBinary>& c);
+
+/**
+ * @brief Obtiene el siguiente elemento en la iteración de la colección binaria
+ * @tparam T Tipo de datos de la colección
+ * @param c Referencia a la colección
+ * @param tFromString Función para convertir std::string a T (no se usa si T es trivialmente copiable)
+ * @return Siguiente elemento
+ */
+template<typename T>
+T collNext(Coll<T, CollBinary>& c, T tFromString(std::string));
+
+/**
+ * @brief Obtiene el siguiente elemento de la colección binaria con indicador de fin
+ * @tparam T Tipo de datos de la colección
+ * @param c Referencia a la colección
+ * @param endOfColl Referencia a booleano que indica si quedan más elementos
+ * @param tFromString Función para convertir std::string a T (no se usa si T es trivialmente copiable)
+ * @return Siguiente elemento
+ */
+template<typename T>
+T collNext(Coll<T, CollBinary>& c, bool& endOfColl, T tFromString(std::string));
+
+/**
+ * @brief Reinicia el iterador de la colección binaria al inicio
+ * @tparam T Tipo de datos de la colección
+ * @param c Referencia a la colección
+ */
+template<typename T>
+void collReset(Coll<T, CollBinary>& c);
+
+/**
+ * @brief Retorna los bytes de la colección binaria
+ * @tparam T Tipo de datos de la colección
+ * @param c Colección a convertir
+ * @return Referencia al string con los registros binarios (no es texto legible)
  */
 template<typename T>
-std::string collToString(Coll<T> c);
+const std::string& collToString(const Coll<T, CollBinary>& c);
 
 #endif //COLL_H
\ No newline at end of file
@@ -0,0 +1,166 @@
+/**
+ * @file Huffman.h
+ * @brief Biblioteca de codificación Huffman canónica sobre BitReader/BitWriter
+ *
+ * Esta biblioteca construye códigos Huffman canónicos a partir de frecuencias, con
+ * longitud máxima de código acotada, y los usa para codificar y decodificar símbolos
+ * sobre BitWriter y BitReader. La decodificación es por tabla: cada consulta resuelve
+ * un código completo de hasta HUFFMAN_TABLE_BITS bits, y en bloque se decodifican
+ * varios símbolos por cada lectura de 57 bits.
+ */
+
+#ifndef HUFFMAN_H
+#define HUFFMAN_H
+
+#include "BitReader.h"
+#include "BitWriter.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Longitud máxima admitida para un código
+ */
+#define HUFFMAN_MAX_BITS 15
+
+/**
+ * @brief Cantidad de bits que resuelve la tabla de decodificación en una consulta
+ */
+#ifndef HUFFMAN_TABLE_BITS
+#define HUFFMAN_TABLE_BITS 11
+#endif
+
+/**
+ * @brief Estructura que representa un código Huffman canónico
+ */
+struct Huffman
+{
+   int n;                                ///< Cantidad de símbolos del alfabeto (0..n-1)
+   int maxLen;                           ///< Longitud del código más largo
+   std::vector<int> lens;                ///< Longitud del código de cada símbolo (0 si no se usa)
+   std::vector<uint32_t> codes;          ///< Código canónico de cada símbolo
+   int tablaBits;                        ///< Bits que indexan la tabla de decodificación
+   std::vector<uint32_t> tabla;          ///< Entrada: símbolo << 4 | longitud (0 si el código es más largo)
+   int primero[HUFFMAN_MAX_BITS + 2];    ///< Primer código canónico de cada longitud
+   int cuenta[HUFFMAN_MAX_BITS + 2];     ///< Cantidad de códigos de cada longitud
+   int desde[HUFFMAN_MAX_BITS + 2];      ///< Posición en orden del primer símbolo de cada longitud
+   std::vector<int> orden;               ///< Símbolos en orden canónico (longitud, símbolo)
+};
+
+/**
+ * @brief Construye un código canónico a partir de las frecuencias de los símbolos
+ * @param freq Frecuencia de cada símbolo (0 si no aparece)
+ * @param n Cantidad de símbolos del alfabeto (hasta 65535)
+ * @param maxBits Longitud máxima de los códigos (entre 1 y HUFFMAN_MAX_BITS)
+ * @return Código construido
+ *
+ * @note Si las longitudes óptimas superan maxBits se redistribuyen respetando la
+ * desigualdad de Kraft, alargando los códigos menos frecuentes. Si hay más de 2^maxBits
+ * símbolos usados, maxBits se aumenta lo necesario (hasta HUFFMAN_MAX_BITS).
+ */
+Huffman huffman(const int freq[], int n, int maxBits);
+
+/**
+ * @brief Construye un código canónico a partir de las longitudes de cada símbolo
+ * @param lens Longitud del código de cada símbolo (0 si no se usa)
+ * @param n Cantidad de símbolos del alfabeto
+ * @return Código construido; si alguna longitud está fuera de 0..HUFFMAN_MAX_BITS o las
+ * longitudes no cumplen la desigualdad de Kraft, un código vacío con n == 0
+ *
+ * @note Las longitudes se validan antes de armar la tabla, así que unas longitudes
+ * corruptas nunca escriben fuera de ella. Se aceptan códigos incompletos (suma de Kraft
+ * menor que 1), como el de un único símbolo de longitud 1.
+ */
+Huffman huffmanFromLengths(const int lens[], int n);
+
+/**
+ * @brief Escribe la cabecera compacta que describe el código
+ * @param bw Referencia al BitWriter
+ * @param h Código a describir
+ *
+ * @note Formato: 16 bits con n y luego la longitud de cada símbolo en 4 bits; una
+ * longitud 0 va seguida de 5 bits con la cantidad de ceros adicionales consecutivos.
+ */
+void huffmanWriteHeader(BitWriter& bw, const Huffman& h);
+
+/**
+ * @brief Lee una cabecera escrita con huffmanWriteHeader y reconstruye el código
+ * @param br Referencia al BitReader
+ * @return Código leído, o un código vacío con n == 0 si la cabecera describe
+ * longitudes inválidas (ver huffmanFromLengths)
+ */
+Huffman huffmanReadHeader(BitReader& br);
+
+/**
+ * @brief Codifica un símbolo
+ * @param bw Referencia al BitWriter
+ * @param h Código a usar
+ * @param sym Símbolo a codificar (con longitud distinta de 0)
+ */
+void huffmanEncode(BitWriter& bw, const Huffman& h, int sym);
+
+/**
+ * @brief Codifica una secuencia de símbolos en una sola pasada
+ * @param bw Referencia al BitWriter
+ * @param h Código a usar
+ * @param syms Símbolos a codificar
+ * @param len Cantidad de símbolos
+ */
+void huffmanEncode(BitWriter& bw, const Huffman& h, const unsigned char syms[], int len);
+
+/**
+ * @brief Codifica una secuencia de símbolos en una sola pasada
+ * @param bw Referencia al BitWriter
+ * @param h Código a usar
+ * @param syms Símbolos a codificar
+ * @param len Cantidad de símbolos
+ */
+void huffmanEncode(BitWriter& bw, const Huffman& h, const int syms[], int len);
+
+/**
+ * @brief Decodifica un símbolo
+ * @param br Referencia al BitReader
+ * @param h Código a usar
+ * @return Símbolo decodificado
+ *
+ * @note Ante datos que no corresponden a ningún código se consume un bit y se
+ * retorna el primer símbolo en orden canónico (o 0 si el código está vacío).
+ */
+int huffmanDecode(BitReader& br, const Huffman& h);
+
+/**
+ * @brief Decodifica una secuencia de símbolos
+ * @param br Referencia al BitReader
+ * @param h Código a usar
+ * @param out Array donde se guardan los símbolos decodificados
+ * @param len Cantidad de símbolos a decodificar
+ *
+ * @note Lee 57 bits por vez y decodifica de ellos todos los símbolos completos posibles.
+ */
+void huffmanDecode(BitReader& br, const Huffman& h, unsigned char out[], int len);
+
+/**
+ * @brief Decodifica una secuencia de símbolos
+ * @param br Referencia al BitReader
+ * @param h Código a usar
+ * @param out Array donde se guardan los símbolos decodificados
+ * @param len Cantidad de símbolos a decodificar
+ */
+void huffmanDecode(BitReader& br, const Huffman& h, int out[], int len);
+
+/**
+ * @brief Comprime un bloque de bytes: cabecera, longitud y datos codificados
+ * @param bw Referencia al BitWriter
+ * @param data Bytes a comprimir
+ * @param len Cantidad de bytes
+ * @param maxBits Longitud máxima de los códigos (entre 1 y HUFFMAN_MAX_BITS)
+ */
+void huffmanCompress(BitWriter& bw, const unsigned char data[], int len, int maxBits);
+
+/**
+ * @brief Descomprime un bloque escrito con huffmanCompress
+ * @param br Referencia al BitReader
+ * @return Bytes descomprimidos (vacío si la cabecera es inválida)
+ */
+std::vector<unsigned char> huffmanDecompress(BitReader& br);
+
+#endif //HUFFMAN_H
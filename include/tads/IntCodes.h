@@ -0,0 +1,153 @@
+/**
+ * @file IntCodes.h
+ * @brief Códigos universales de enteros sobre BitReader/BitWriter
+ *
+ * Esta biblioteca proporciona codificadores y decodificadores de Elias gamma, Elias
+ * delta, Golomb-Rice y varint LEB128 sobre los flujos de bits, tanto para valores
+ * sueltos como para un Array<int> completo. Los decodificadores leen una palabra de
+ * hasta 57 bits y cuentan los ceros iniciales en lugar de recorrer bit por bit.
+ */
+
+#ifndef INTCODES_H
+#define INTCODES_H
+
+#include "Array.h"
+#include "BitReader.h"
+#include "BitWriter.h"
+#include <cstdint>
+
+/**
+ * @brief Codifica un valor con Elias gamma
+ * @param bw Referencia al BitWriter
+ * @param x Valor a codificar (mayor o igual a 1)
+ *
+ * @note Se escriben floor(log2 x) ceros seguidos de x en binario: 2·floor(log2 x)+1 bits.
+ */
+void gammaEncode(BitWriter& bw, uint32_t x);
+
+/**
+ * @brief Decodifica un valor escrito con gammaEncode
+ * @param br Referencia al BitReader
+ * @return Valor decodificado, o 0 si los datos no son válidos o se terminó el flujo
+ */
+uint32_t gammaDecode(BitReader& br);
+
+/**
+ * @brief Codifica un valor con Elias delta
+ * @param bw Referencia al BitWriter
+ * @param x Valor a codificar (mayor o igual a 1)
+ *
+ * @note Se escribe con gamma la cantidad de bits de x y luego x sin su bit más alto.
+ */
+void deltaEncode(BitWriter& bw, uint32_t x);
+
+/**
+ * @brief Decodifica un valor escrito con deltaEncode
+ * @param br Referencia al BitReader
+ * @return Valor decodificado, o 0 si los datos no son válidos o se terminó el flujo
+ */
+uint32_t deltaDecode(BitReader& br);
+
+/**
+ * @brief Codifica un valor con Golomb-Rice de parámetro k
+ * @param bw Referencia al BitWriter
+ * @param x Valor a codificar
+ * @param k Parámetro (entre 0 y 31): el divisor es 2^k
+ *
+ * @note Se escribe el cociente x >> k en unario (ceros terminados en un 1) y luego
+ * los k bits bajos de x.
+ */
+void riceEncode(BitWriter& bw, uint32_t x, int k);
+
+/**
+ * @brief Decodifica un valor escrito con riceEncode
+ * @param br Referencia al BitReader
+ * @param k Parámetro usado al codificar
+ * @return Valor decodificado
+ */
+uint32_t riceDecode(BitReader& br, int k);
+
+/**
+ * @brief Codifica un valor como varint LEB128
+ * @param bw Referencia al BitWriter
+ * @param x Valor a codificar
+ *
+ * @note Grupos de 7 bits desde el menos significativo, en unidades de 8 bits cuyo bit
+ * alto indica si sigue otro grupo (1 a 10 unidades).
+ */
+void varintEncode(BitWriter& bw, uint64_t x);
+
+/**
+ * @brief Decodifica un valor escrito con varintEncode
+ * @param br Referencia al BitReader
+ * @return Valor decodificado
+ */
+uint64_t varintDecode(BitReader& br);
+
+/**
+ * @brief Codifica todos los elementos de un array con Elias gamma
+ * @param bw Referencia al BitWriter
+ * @param a Array a codificar (elementos mayores o iguales a 1)
+ *
+ * @note La cantidad de elementos se escribe primero como varint.
+ */
+void gammaEncode(BitWriter& bw, const Array<int>& a);
+
+/**
+ * @brief Decodifica un array escrito con gammaEncode y agrega sus elementos a a
+ * @param br Referencia al BitReader
+ * @param a Referencia al array donde se agregan los elementos
+ */
+void gammaDecode(BitReader& br, Array<int>& a);
+
+/**
+ * @brief Codifica todos los elementos de un array con Elias delta
+ * @param bw Referencia al BitWriter
+ * @param a Array a codificar (elementos mayores o iguales a 1)
+ *
+ * @note La cantidad de elementos se escribe primero como varint.
+ */
+void deltaEncode(BitWriter& bw, const Array<int>& a);
+
+/**
+ * @brief Decodifica un array escrito con deltaEncode y agrega sus elementos a a
+ * @param br Referencia al BitReader
+ * @param a Referencia al array donde se agregan los elementos
+ */
+void deltaDecode(BitReader& br, Array<int>& a);
+
+/**
+ * @brief Codifica todos los elementos de un array con Golomb-Rice de parámetro k
+ * @param bw Referencia al BitWriter
+ * @param a Array a codificar (elementos no negativos)
+ * @param k Parámetro (entre 0 y 31)
+ *
+ * @note La cantidad de elementos se escribe primero como varint.
+ */
+void riceEncode(BitWriter& bw, const Array<int>& a, int k);
+
+/**
+ * @brief Decodifica un array escrito con riceEncode y agrega sus elementos a a
+ * @param br Referencia al BitReader
+ * @param a Referencia al array donde se agregan los elementos
+ * @param k Parámetro usado al codificar
+ */
+void riceDecode(BitReader& br, Array<int>& a, int k);
+
+/**
+ * @brief Codifica todos los elementos de un array como varint LEB128
+ * @param bw Referencia al BitWriter
+ * @param a Array a codificar (los negativos ocupan 5 unidades)
+ *
+ * @note La cantidad de elementos se escribe primero como varint.
+ */
+void varintEncode(BitWriter& bw, const Array<int>& a);
+
+/**
+ * @brief Decodifica un array escrito con varintEncode y agrega sus elementos a a
+ * @param br Referencia al BitReader
+ * @param a Referencia al array donde se agregan los elementos
+ */
+void varintDecode(BitReader& br, Array<int>& a);
+
+#endif //INTCODES_H
@@ -0,0 +1,65 @@
+/**
+ * @file Lzss.h
+ * @brief Compresión LZSS sobre BitWriter/BitReader
+ *
+ * Esta biblioteca comprime bloques de bytes reemplazando las repeticiones por pares
+ * (distancia, longitud) hacia una ventana de datos anteriores. Las coincidencias se
+ * buscan con cadenas de hash sobre los primeros LZSS_MIN_MATCH bytes, con evaluación
+ * diferida (lazy matching) configurable. La salida se escribe con BitWriter, por lo
+ * que puede combinarse con otras capas de codificación sobre el mismo flujo.
+ *
+ * Formato: 32 bits con la longitud original, 5 bits con windowBits y 4 bits con la
+ * cantidad de bits de longitud; luego, cada literal es un 0 seguido del byte y cada
+ * coincidencia es un 1 seguido de distancia - 1 (windowBits bits) y longitud -
+ * LZSS_MIN_MATCH.
+ */
+
+#ifndef LZSS_H
+#define LZSS_H
+
+#include "BitReader.h"
+#include "BitWriter.h"
+#include <vector>
+
+/**
+ * @brief Longitud mínima de una coincidencia
+ */
+#define LZSS_MIN_MATCH 3
+
+/**
+ * @brief Bits con que se codifica la longitud de una coincidencia (máximo 258 bytes)
+ */
+#ifndef LZSS_LEN_BITS
+#define LZSS_LEN_BITS 8
+#endif
+
+/**
+ * @brief Cantidad máxima de candidatos que se revisan en cada cadena de hash
+ */
+#ifndef LZSS_CHAIN
+#define LZSS_CHAIN 64
+#endif
+
+/**
+ * @brief Comprime un bloque de bytes
+ * @param bw Referencia al BitWriter donde se escribe el bloque comprimido
+ * @param data Bytes a comprimir
+ * @param len Cantidad de bytes
+ * @param windowBits Logaritmo en base 2 del tamaño de la ventana (entre 8 y 24)
+ * @param lazy Cantidad de posiciones siguientes en que se busca una coincidencia más
+ * larga antes de aceptar la actual (0 para búsqueda voraz)
+ */
+void lzssCompress(BitWriter& bw, const unsigned char data[], int len, int windowBits, int lazy);
+
+/**
+ * @brief Descomprime un bloque escrito con lzssCompress
+ * @param br Referencia al BitReader
+ * @return Bytes descomprimidos, o un vector vacío si el bloque es inválido: longitud
+ * negativa, parámetros fuera de rango, una coincidencia que apunta antes del inicio o
+ * pasa de la longitud declarada, o datos que terminan antes de completarla
+ *
+ * @note Las coincidencias con distancia de al menos 8 bytes se copian de a 8 bytes.
+ */
+std::vector<unsigned char> lzssDecompress(BitReader& br);
+
+#endif //LZSS_H
@@ -0,0 +1,148 @@
+/**
+ * @file MappedMatrix.h
+ * @brief Biblioteca de funciones para matrices respaldadas por un archivo binario
+ *
+ * Esta biblioteca proporciona una matriz cuyos elementos viven en un archivo binario de
+ * registros T en orden por filas, de modo que puede superar la memoria disponible. Sólo
+ * se mantienen en memoria algunos bloques (tiles) del archivo, que se cargan a demanda y
+ * se desalojan por antigüedad de uso. Comparte con Matrix<T> la semántica de mtxGetAt y
+ * mtxSetAt; los cambios llegan al disco al desalojar un bloque o al llamar a mtxSync.
+ */
+
+#ifndef MAPPEDMATRIX_H
+#define MAPPEDMATRIX_H
+
+#include <cstdio>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Tamaño en bytes de cada bloque del archivo que se carga en memoria
+ */
+#ifndef MAPPED_MATRIX_TILE_BYTES
+#define MAPPED_MATRIX_TILE_BYTES 65536
+#endif
+
+/**
+ * @brief Cantidad de bloques residentes por defecto
+ */
+#ifndef MAPPED_MATRIX_CACHE_TILES
+#define MAPPED_MATRIX_CACHE_TILES 256
+#endif
+
+/**
+ * @brief Bloque del archivo cargado en memoria
+ * @tparam T Tipo de datos de la matriz
+ */
+template <typename T>
+struct _MappedTile
+{
+   long long id;             ///< Número de bloque dentro del archivo (-1 si está libre)
+   std::vector<T> datos;     ///< Elementos del bloque
+   bool sucio;               ///< Indica si el bloque tiene cambios sin escribir
+   unsigned long long uso;   ///< Marca del último acceso, para el desalojo
+};
+
+/**
+ * @brief Estructura que representa una matriz respaldada por un archivo binario
+ * @tparam T Tipo de datos de la matriz (copiable bit a bit)
+ *
+ * El caché de bloques es mutable para que las lecturas puedan cargar bloques a demanda
+ * sobre una matriz constante.
+ */
+template <typename T>
+struct MappedMatrix
+{
+   FILE* arch;                                  ///< Archivo de respaldo
+   int f;                                       ///< Número de filas
+   int c;                                       ///< Número de columnas
+   bool escritura;                              ///< Indica si la matriz admite escrituras
+   int tileLen;                                 ///< Cantidad de elementos por bloque
+   mutable std::vector<_MappedTile<T>> tiles;   ///< Bloques residentes
+   mutable std::unordered_map<long long, int> idx;  ///< Bloque del archivo -> posición en tiles
+   mutable int ultimo;                          ///< Posición en tiles del último bloque usado
+   mutable unsigned long long reloj;            ///< Contador de accesos
+   mutable bool fallo;                          ///< Indica si se perdió un bloque desalojado por un error de escritura
+};
+
+/**
+ * @brief Abre una matriz respaldada por un archivo binario
+ * @tparam T Tipo de datos de la matriz
+ * @param path Ruta del archivo de registros T en orden por filas
+ * @param f Número de filas
+ * @param c Número de columnas
+ * @param escritura Si es true se abre para lectura y escritura (creando o extendiendo
+ * el archivo si hace falta); si es false, sólo para lectura
+ * @param maxTiles Cantidad máxima de bloques residentes en memoria
+ * @return Matriz abierta; arch es NULL si no se pudo abrir el archivo
+ *
+ * @note El llamador debe comprobar arch antes de usar la matriz. Sobre una matriz sin
+ * archivo mtxGetAt retorna T() y mtxSetAt, mtxSync y mtxFree no hacen nada.
+ */
+template <typename T>
+MappedMatrix<T> mappedMatrix(const char* path, int f, int c, bool escritura, int maxTiles);
+
+/**
+ * @brief Abre una matriz respaldada por un archivo binario con MAPPED_MATRIX_CACHE_TILES bloques
+ * @tparam T Tipo de datos de la matriz
+ * @param path Ruta del archivo de registros T en orden por filas
+ * @param f Número de filas
+ * @param c Número de columnas
+ * @param escritura Si es true se abre para lectura y escritura; si es false, sólo para lectura
+ * @return Matriz abierta; arch es NULL si no se pudo abrir el archivo
+ */
+template <typename T>
+MappedMatrix<T> mappedMatrix(const char* path, int f, int c, bool escritura);
+
+/**
+ * @brief Escribe en el archivo todos los bloques modificados y vacía el buffer del archivo
+ * @tparam T Tipo de datos de la matriz
+ * @param m Referencia a la matriz
+ * @return false si alguna escritura falló, incluida la de un bloque desalojado desde la
+ * apertura; true en otro caso
+ *
+ * @note Un bloque residente que no se pudo escribir sigue marcado como modificado y se
+ * reintenta en la próxima llamada. Un bloque desalojado que no se pudo escribir se pierde.
+ */
+template <typename T>
+bool mtxSync(MappedMatrix<T>& m);
+
+/**
+ * @brief Sincroniza la matriz, cierra el archivo y libera los bloques residentes
+ * @tparam T Tipo de datos de la matriz
+ * @param m Referencia a la matriz
+ *
+ * @note Para saber si los cambios llegaron al archivo hay que llamar antes a mtxSync.
+ */
+template <typename T>
+void mtxFree(MappedMatrix<T>& m);
+
+/**
+ * @brief Obtiene el elemento en la posición especificada
+ * @tparam T Tipo de datos de la matriz
+ * @param m Matriz de la cual obtener el elemento
+ * @param f Fila del elemento
+ * @param c Columna del elemento
+ * @return Elemento en la posición (f, c), o T() si la matriz no tiene archivo abierto
+ *
+ * @note Si el bloque que contiene el elemento no está en memoria se carga del archivo,
+ * desalojando el bloque usado hace más tiempo.
+ */
+template <typename T>
+T mtxGetAt(const MappedMatrix<T>& m, int f, int c);
+
+/**
+ * @brief Establece el valor del elemento en la posición especificada
+ * @tparam T Tipo de datos de la matriz
+ * @param m Referencia a la matriz a modificar (abierta para escritura)
+ * @param t Valor a establecer
+ * @param f Fila del elemento
+ * @param c Columna del elemento
+ *
+ * @note El cambio queda en memoria hasta que el bloque se desaloja o se llama a mtxSync.
+ * No hace nada si la matriz no tiene archivo abierto o se abrió sólo para lectura.
+ */
+template <typename T>
+void mtxSetAt(MappedMatrix<T>& m, T t, int f, int c);
+
+#endif //MAPPEDMATRIX_H
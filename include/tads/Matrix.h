@@ -7,25 +7,67 @@
  *
  * Esta biblioteca proporciona funciones para el manejo de matrices bidimensionales
  * utilizando plantillas. Permite crear, acceder y modificar matrices de cualquier tipo
- * usando una estructura basada en colecciones lineales.
+ * usando almacenamiento contiguo por filas, con acceso O(1) a cada elemento.
+ * Las operaciones paralelas reparten las filas entre hilos que se crean en la primera
+ * llamada y se reutilizan en las siguientes. Una operación paralela invocada desde
+ * dentro de otra (por ejemplo desde la función de mtxMap) se ejecuta en serie.
  */
 
 #ifndef MATRIX_H
 #define MATRIX_H
 
 #include <string>
-#include "Coll.h"
+
+/**
+ * @brief Alineación por defecto (en bytes) del inicio de cada fila
+ *
+ * Con 64 bytes cada fila empieza en una línea de caché y admite cargas vectoriales
+ * alineadas de hasta 512 bits. Puede redefinirse antes de incluir este archivo.
+ */
+#ifndef MATRIX_ALIGNMENT
+#define MATRIX_ALIGNMENT 64
+#endif
+
+/**
+ * @brief Tamaño de bloque (en filas de B / columnas de A) del producto de matrices
+ *
+ * Junto con MATRIX_BLOCK_J fija el bloque de B que se reutiliza desde la caché L2
+ * mientras se recorren todas las filas de A.
+ */
+#ifndef MATRIX_BLOCK_K
+#define MATRIX_BLOCK_K 128
+#endif
+
+/**
+ * @brief Tamaño de bloque (en columnas de B y C) del producto de matrices
+ *
+ * Cada tramo de fila de C de este largo se mantiene en la caché L1 mientras se acumula.
+ */
+#ifndef MATRIX_BLOCK_J
+#define MATRIX_BLOCK_J 256
+#endif
 
 /**
  * @brief Estructura que representa una matriz bidimensional
  * @tparam T Tipo de datos que almacena la matriz
+ *
+ * Los elementos se guardan contiguos en orden por filas. Cada fila ocupa ld elementos
+ * (c más el relleno necesario para que la siguiente fila quede alineada).
+ *
+ * @note A diferencia de la versión basada en Coll, la estructura no es dueña de una copia
+ * propia de los datos: copiar un Matrix (asignación, paso por valor) copia el puntero y
+ * ambas variables comparten los mismos elementos. Para una copia independiente se usa
+ * mtxCopy, y cada matriz creada con matrix o mtxCopy debe liberarse una sola vez con
+ * mtxFree.
  */
 template <typename T>
 struct Matrix
 {
-   Coll<T> datos;  ///< Colección que almacena los datos de la matriz
-   int f;          ///< Número de filas
-   int c;          ///< Número de columnas
+   T* datos;  ///< Elementos de la matriz, fila por fila
+   int f;     ///< Número de filas
+   int c;     ///< Número de columnas
+   int ld;    ///< Distancia en elementos entre el inicio de dos filas consecutivas
+   int alin;  ///< Alineación en bytes del inicio de cada fila
 };
 
 /**
@@ -34,22 +76,91 @@ struct Matrix
  * @param f Número de filas
  * @param c Número de columnas
  * @param valorDefault Valor por defecto para inicializar todos los elementos
- * @param tToString Función para convertir T a std::string
+ * @param alin Alineación en bytes del inicio de cada fila; si no es potencia de 2 se
+ * redondea a la siguiente, y nunca es menor que alignof(T)
+ * @return Nueva matriz inicializada
+ */
+template <typename T>
+Matrix<T> matrix(int f, int c, T valorDefault, int alin);
+
+/**
+ * @brief Crea una nueva matriz con la alineación por defecto (MATRIX_ALIGNMENT)
+ * @tparam T Tipo de datos de la matriz
+ * @param f Número de filas
+ * @param c Número de columnas
+ * @param valorDefault Valor por defecto para inicializar todos los elementos
+ * @return Nueva matriz inicializada
+ */
+template <typename T>
+Matrix<T> matrix(int f, int c, T valorDefault);
+
+/**
+ * @brief Crea una nueva matriz con dimensiones y valor por defecto especificados
+ * @tparam T Tipo de datos de la matriz
+ * @param f Número de filas
+ * @param c Número de columnas
+ * @param valorDefault Valor por defecto para inicializar todos los elementos
+ * @param tToString Función para convertir T a std::string (ya no se usa)
  * @return Nueva matriz inicializada
+ *
+ * @note Se conserva por compatibilidad: los elementos ya no se guardan como texto.
  */
 template <typename T>
 Matrix<T> matrix(int f, int c, T valorDefault, std::string tToString(T));
 
+/**
+ * @brief Crea una copia independiente de la matriz
+ * @tparam T Tipo de datos de la matriz
+ * @param m Matriz a copiar
+ * @return Nueva matriz con las mismas dimensiones, alineación y elementos
+ *
+ * @note La copia debe liberarse con mtxFree por separado del original.
+ */
+template <typename T>
+Matrix<T> mtxCopy(const Matrix<T>& m);
+
+/**
+ * @brief Libera la memoria de la matriz
+ * @tparam T Tipo de datos de la matriz
+ * @param m Referencia a la matriz a liberar
+ */
+template <typename T>
+void mtxFree(Matrix<T>& m);
+
 /**
  * @brief Convierte coordenadas bidimensionales a índice unidimensional
  * @tparam T Tipo de datos de la matriz
  * @param m Matriz de referencia
  * @param f Fila
  * @param c Columna
- * @return Índice unidimensional correspondiente
+ * @return Índice del elemento dentro de datos
+ *
+ * @note El índice es int, así que sólo sirve para matrices de menos de INT_MAX
+ * elementos; mtxRow, mtxGetAt y mtxSetAt no tienen ese límite.
+ */
+template <typename T>
+int coordenadasToInt(const Matrix<T>& m, int f, int c);
+
+/**
+ * @brief Obtiene un puntero al inicio de una fila
+ * @tparam T Tipo de datos de la matriz
+ * @param m Matriz de referencia
+ * @param f Fila
+ * @return Puntero al primer elemento de la fila (alineado a m.alin bytes)
+ */
+template <typename T>
+T* mtxRow(const Matrix<T>& m, int f);
+
+/**
+ * @brief Obtiene el elemento en la posición especificada
+ * @tparam T Tipo de datos de la matriz
+ * @param m Matriz de la cual obtener el elemento
+ * @param f Fila del elemento
+ * @param c Columna del elemento
+ * @return Elemento en la posición (f, c)
  */
 template <typename T>
-int coordenadasToInt(Matrix<T> m, int f, int c);
+T mtxGetAt(const Matrix<T>& m, int f, int c);
 
 /**
  * @brief Obtiene el elemento en la posición especificada
@@ -57,11 +168,22 @@ int coordenadasToInt(Matrix<T> m, int f, int c);
  * @param m Matriz de la cual obtener el elemento
  * @param f Fila del elemento
  * @param c Columna del elemento
- * @param tFromString Función para convertir std::string a T
+ * @param tFromString Función para convertir std::string a T (ya no se usa)
  * @return Elemento en la posición (f, c)
  */
 template <typename T>
-T mtxGetAt(Matrix<T> m, int f, int c, T tFromString(std::string));
+T mtxGetAt(const Matrix<T>& m, int f, int c, T tFromString(std::string));
+
+/**
+ * @brief Establece el valor del elemento en la posición especificada
+ * @tparam T Tipo de datos de la matriz
+ * @param m Referencia a la matriz a modificar
+ * @param t Valor a establecer
+ * @param f Fila del elemento
+ * @param c Columna del elemento
+ */
+template <typename T>
+void mtxSetAt(Matrix<T>& m, T t, int f, int c);
 
 /**
  * @brief Establece el valor del elemento en la posición especificada
@@ -70,9 +192,107 @@ T mtxGetAt(Matrix<T> m, int f, int c, T tFromString(std::string));
  * @param t Valor a establecer
  * @param f Fila del elemento
  * @param c Columna del elemento
- * @param tToString Función para convertir T a std::string
+ * @param tToString Función para convertir T a std::string (ya no se usa)
  */
 template <typename T>
 void mtxSetAt(Matrix<T>& m, T t, int f, int c, std::string tToString(T));
 
-#endif //MATRIX_H
\ No newline at end of file
+/**
+ * @brief Acumula en c el producto a·b (c += a·b)
+ * @tparam T Tipo de datos de las matrices
+ * @param c Referencia a la matriz acumuladora, de a.f filas y b.c columnas
+ * @param a Matriz izquierda
+ * @param b Matriz derecha, con tantas filas como columnas tiene a
+ *
+ * @note El recorrido se hace por bloques de MATRIX_BLOCK_K x MATRIX_BLOCK_J para
+ * reutilizar b desde la caché. Para float, double y enteros de 32 bits el bucle
+ * interno usa AVX2/FMA si el procesador lo admite.
+ */
+template <typename T>
+void mtxMultiplyAdd(Matrix<T>& c, const Matrix<T>& a, const Matrix<T>& b);
+
+/**
+ * @brief Calcula el producto de dos matrices
+ * @tparam T Tipo de datos de las matrices
+ * @param a Matriz izquierda
+ * @param b Matriz derecha, con tantas filas como columnas tiene a
+ * @return Nueva matriz de a.f filas y b.c columnas con el producto a·b
+ */
+template <typename T>
+Matrix<T> mtxMultiply(const Matrix<T>& a, const Matrix<T>& b);
+
+/**
+ * @brief Suma elemento a elemento dos matrices de iguales dimensiones
+ * @tparam T Tipo de datos de las matrices
+ * @param a Primera matriz
+ * @param b Segunda matriz
+ * @return Nueva matriz con a + b
+ */
+template <typename T>
+Matrix<T> mtxAdd(const Matrix<T>& a, const Matrix<T>& b);
+
+/**
+ * @brief Multiplica cada elemento de una matriz por un escalar
+ * @tparam T Tipo de datos de la matriz
+ * @param a Matriz de origen
+ * @param k Escalar
+ * @return Nueva matriz con k·a
+ */
+template <typename T>
+Matrix<T> mtxScale(const Matrix<T>& a, T k);
+
+/**
+ * @brief Calcula la traspuesta de una matriz
+ * @tparam T Tipo de datos de la matriz
+ * @param a Matriz de origen
+ * @return Nueva matriz de a.c filas y a.f columnas
+ *
+ * @note Se copia por bloques cuadrados para que tanto las lecturas como las
+ * escrituras se mantengan dentro de pocas líneas de caché.
+ */
+template <typename T>
+Matrix<T> mtxTranspose(const Matrix<T>& a);
+
+/**
+ * @brief Calcula la suma de cada fila repartiendo las filas entre varios hilos
+ * @tparam T Tipo de datos de la matriz
+ * @param m Matriz de origen
+ * @param out Array de m.f elementos donde se guarda la suma de cada fila
+ * @param threads Cantidad de hilos (si es menor o igual a 0 se usan los núcleos disponibles)
+ *
+ * @note Cada fila se suma completa en un único hilo y en el mismo orden que en la
+ * versión de un hilo, por lo que el resultado no depende de la cantidad de hilos.
+ * Requiere compilar con -pthread.
+ */
+template <typename T>
+void mtxRowSums(const Matrix<T>& m, T out[], int threads);
+
+/**
+ * @brief Calcula la suma de cada columna repartiendo las filas entre varios hilos
+ * @tparam T Tipo de datos de la matriz
+ * @param m Matriz de origen
+ * @param out Array de m.c elementos donde se guarda la suma de cada columna
+ * @param threads Cantidad de hilos (si es menor o igual a 0 se usan los núcleos disponibles)
+ *
+ * @note Cada hilo acumula su bloque de filas en una fila propia de una matriz auxiliar,
+ * alineada a MATRIX_ALIGNMENT para que los hilos no compartan líneas de caché, y
+ * luego las sumas parciales se combinan en orden de bloque. Para tipos enteros el
+ * resultado es idéntico al de un hilo; en punto flotante el redondeo puede variar
+ * según la cantidad de hilos. Requiere compilar con -pthread.
+ */
+template <typename T>
+void mtxColSums(const Matrix<T>& m, T out[], int threads);
+
+/**
+ * @brief Aplica una función a cada elemento de la matriz repartiendo las filas entre hilos
+ * @tparam T Tipo de datos de la matriz
+ * @param m Referencia a la matriz a modificar
+ * @param fn Función a aplicar; se reemplaza cada elemento x por fn(x)
+ * @param threads Cantidad de hilos (si es menor o igual a 0 se usan los núcleos disponibles)
+ *
+ * @note fn debe poder llamarse en paralelo. Requiere compilar con -pthread.
+ */
+template <typename T>
+void mtxMap(Matrix<T>& m, T fn(T), int threads);
+
+#endif //MATRIX_H
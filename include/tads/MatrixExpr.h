@@ -0,0 +1,158 @@
+/**
+ * @file MatrixExpr.h
+ * @brief Expresiones diferidas para la aritmética de Matrix<T>
+ *
+ * Esta biblioteca define los operadores +, -, * y / entre matrices y escalares de modo
+ * que no calculan nada: construyen una expresión que describe la cuenta. La expresión se
+ * evalúa recién con mtxEval o mtxAssign, en una única pasada por filas sobre la memoria
+ * y sin matrices temporales intermedias. Por ejemplo, A + B * c - D recorre una sola vez
+ * A, B y D y escribe una sola vez el resultado.
+ */
+
+#ifndef MATRIXEXPR_H
+#define MATRIXEXPR_H
+
+#include "Matrix.h"
+#include <type_traits>
+
+/**
+ * @brief Operación suma elemento a elemento
+ */
+struct MtxAdd {};
+
+/**
+ * @brief Operación resta elemento a elemento
+ */
+struct MtxSub {};
+
+/**
+ * @brief Operación producto por escalar
+ */
+struct MtxMul {};
+
+/**
+ * @brief Operación división por escalar
+ */
+struct MtxDiv {};
+
+/**
+ * @brief Nodo de una expresión diferida
+ * @tparam T Tipo de datos del resultado
+ * @tparam Op Operación (MtxAdd, MtxSub, MtxMul o MtxDiv)
+ * @tparam L Operando izquierdo: Matrix<T>, otra expresión o un escalar
+ * @tparam R Operando derecho: Matrix<T>, otra expresión o un escalar
+ *
+ * @note Las matrices se guardan por valor; como Matrix<T> sólo referencia sus datos, la
+ * expresión no copia elementos, pero las matrices deben seguir vivas hasta evaluarla.
+ */
+template <typename T, typename Op, typename L, typename R>
+struct MtxExpr
+{
+   L l;  ///< Operando izquierdo
+   R r;  ///< Operando derecho
+};
+
+/**
+ * @brief Rasgos de los operandos de una expresión (escalares por defecto)
+ */
+template <typename X>
+struct _MtxTraits
+{
+   static const bool operando = false;
+};
+
+template <typename T>
+struct _MtxTraits<Matrix<T>>
+{
+   static const bool operando = true;
+   typedef T tipo;
+};
+
+template <typename T, typename Op, typename L, typename R>
+struct _MtxTraits<MtxExpr<T, Op, L, R>>
+{
+   static const bool operando = true;
+   typedef T tipo;
+};
+
+/**
+ * @brief Tipo del nodo resultante de operar dos matrices o expresiones
+ */
+template <typename Op, typename L, typename R>
+using _MtxBinaria = typename std::enable_if<_MtxTraits<L>::operando && _MtxTraits<R>::operando,
+                                            MtxExpr<typename _MtxTraits<L>::tipo, Op, L, R>>::type;
+
+/**
+ * @brief Tipo del nodo resultante de operar una matriz o expresión con un escalar
+ */
+template <typename Op, typename L, typename R, typename X>
+using _MtxEscalar = typename std::enable_if<_MtxTraits<X>::operando,
+                                            MtxExpr<typename _MtxTraits<X>::tipo, Op, L, R>>::type;
+
+/**
+ * @brief Suma diferida elemento a elemento
+ * @param l Matriz o expresión izquierda
+ * @param r Matriz o expresión derecha, de iguales dimensiones
+ * @return Expresión que representa l + r
+ */
+template <typename L, typename R>
+_MtxBinaria<MtxAdd, L, R> operator+(const L& l, const R& r);
+
+/**
+ * @brief Resta diferida elemento a elemento
+ * @param l Matriz o expresión izquierda
+ * @param r Matriz o expresión derecha, de iguales dimensiones
+ * @return Expresión que representa l - r
+ */
+template <typename L, typename R>
+_MtxBinaria<MtxSub, L, R> operator-(const L& l, const R& r);
+
+/**
+ * @brief Producto diferido por escalar
+ * @param l Matriz o expresión
+ * @param k Escalar
+ * @return Expresión que representa l·k
+ */
+template <typename L>
+_MtxEscalar<MtxMul, L, typename _MtxTraits<L>::tipo, L> operator*(const L& l, typename _MtxTraits<L>::tipo k);
+
+/**
+ * @brief Producto diferido por escalar
+ * @param k Escalar
+ * @param r Matriz o expresión
+ * @return Expresión que representa k·r
+ */
+template <typename R>
+_MtxEscalar<MtxMul, typename _MtxTraits<R>::tipo, R, R> operator*(typename _MtxTraits<R>::tipo k, const R& r);
+
+/**
+ * @brief División diferida por escalar
+ * @param l Matriz o expresión
+ * @param k Escalar
+ * @return Expresión que representa l / k
+ */
+template <typename L>
+_MtxEscalar<MtxDiv, L, typename _MtxTraits<L>::tipo, L> operator/(const L& l, typename _MtxTraits<L>::tipo k);
+
+/**
+ * @brief Evalúa una expresión sobre una matriz existente
+ * @tparam T Tipo de datos de la matriz
+ * @param m Referencia a la matriz destino, con las dimensiones de la expresión
+ * @param e Expresión a evaluar
+ *
+ * @note Cada elemento se calcula leyendo sólo la misma posición de los operandos, por lo
+ * que m puede ser también uno de ellos (por ejemplo, mtxAssign(A, A + B)).
+ */
+template <typename T, typename Op, typename L, typename R>
+void mtxAssign(Matrix<T>& m, const MtxExpr<T, Op, L, R>& e);
+
+/**
+ * @brief Evalúa una expresión en una nueva matriz
+ * @tparam T Tipo de datos del resultado
+ * @param e Expresión a evaluar
+ * @return Nueva matriz con el resultado
+ */
+template <typename T, typename Op, typename L, typename R>
+Matrix<T> mtxEval(const MtxExpr<T, Op, L, R>& e);
+
+#endif //MATRIXEXPR_H
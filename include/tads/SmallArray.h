@@ -0,0 +1,216 @@
+/**
+ * @file SmallArray.h
+ * @brief Biblioteca de arrays dinámicos con almacenamiento interno para pocos elementos
+ *
+ * Esta biblioteca proporciona una variante de Array que guarda hasta N elementos
+ * dentro de la propia estructura y recién usa memoria dinámica cuando se supera
+ * esa cantidad. Ofrece la misma familia de funciones que Array (arrayAdd, arrayGet,
+ * arrayFind, etc.), por lo que ambas estructuras pueden intercambiarse.
+ */
+
+#ifndef SMALLARRAY_H
+#define SMALLARRAY_H
+
+#include "Array.h"
+
+/**
+ * @brief Estructura de array dinámico con almacenamiento interno
+ * @tparam T Tipo de datos a almacenar
+ * @tparam N Cantidad de elementos que se guardan sin pedir memoria dinámica
+ *
+ * @warning Los elementos pueden vivir dentro de la estructura, por lo que no debe
+ * copiarse por valor: todas las funciones la reciben por referencia.
+ */
+template<typename T, int N>
+struct SmallArray
+{
+   alignas(T) unsigned char buf[N * sizeof(T)]; ///< Almacenamiento interno para N elementos
+   T* heap; ///< Memoria dinámica, NULL mientras los elementos entren en buf
+   int len; ///< Longitud actual del array
+   int cap; ///< Capacidad total del array
+};
+
+/**
+ * @brief Crea un nuevo array vacío que usa su almacenamiento interno
+ * @tparam T Tipo de datos del array
+ * @tparam N Capacidad del almacenamiento interno
+ * @return Array inicializado
+ */
+template<typename T, int N>
+SmallArray<T, N> smallArrayCreate();
+
+/**
+ * @brief Retorna un puntero al primer elemento del array
+ * @tparam T Tipo de datos del array
+ * @tparam N Capacidad del almacenamiento interno
+ * @param a Referencia al array
+ * @return Puntero al almacenamiento interno o a la memoria dinámica
+ */
+template<typename T, int N>
+T* smallArrayData(SmallArray<T, N>& a);
+
+/**
+ * @brief Reserva capacidad para al menos n elementos
+ * @tparam T Tipo de datos del array
+ * @tparam N Capacidad del almacenamiento interno
+ * @param a Referencia al array
+ * @param n Capacidad mínima requerida
+ */
+template<typename T, int N>
+void arrayReserve(SmallArray<T, N>& a, int n);
+
+/**
+ * @brief Retorna la capacidad actual del array
+ * @tparam T Tipo de datos del array
+ * @tparam N Capacidad del almacenamiento interno
+ * @param a Referencia al array
+ * @return Cantidad de elementos que entran sin redimensionar
+ */
+template<typename T, int N>
+int arrayCapacity(SmallArray<T, N>& a);
+
+/**
+ * @brief Agrega un elemento al final del array
+ * @tparam T Tipo de datos del array
+ * @tparam N Capacidad del almacenamiento interno
+ * @param a Referencia al array
+ * @param t Elemento a agregar
+ * @return Índice del elemento agregado
+ */
+template<typename T, int N>
+int arrayAdd(SmallArray<T, N>& a, T t);
+
+/**
+ * @brief Construye un elemento al final del array a partir de sus argumentos
+ * @tparam T Tipo de datos del array
+ * @tparam N Capacidad del almacenamiento interno
+ * @tparam Args Tipos de los argumentos del constructor de T
+ * @param a Referencia al array
+ * @param args Argumentos que se pasan al constructor de T
+ * @return Índice del elemento agregado
+ */
+template<typename T, int N, typename... Args>
+int arrayEmplace(SmallArray<T, N>& a, Args&&... args);
+
+/**
+ * @brief Obtiene un puntero al elemento en la posición especificada
+ * @tparam T Tipo de datos del array
+ * @tparam N Capacidad del almacenamiento interno
+ * @param a Referencia al array
+ * @param p Posición del elemento
+ * @return Puntero al elemento
+ */
+template<typename T, int N>
+T* arrayGet(SmallArray<T, N>& a, int p);
+
+/**
+ * @brief Establece el valor de un elemento en la posición especificada
+ * @tparam T Tipo de datos del array
+ * @tparam N Capacidad del almacenamiento interno
+ * @param a Referencia al array
+ * @param p Posición del elemento
+ * @param t Nuevo valor del elemento
+ */
+template<typename T, int N>
+void arraySet(SmallArray<T, N>& a, int p, T t);
+
+/**
+ * @brief Inserta un elemento en la posición especificada
+ * @tparam T Tipo de datos del array
+ * @tparam N Capacidad del almacenamiento interno
+ * @param a Referencia al array
+ * @param t Elemento a insertar
+ * @param p Posición donde insertar
+ */
+template<typename T, int N>
+void arrayInsert(SmallArray<T, N>& a, T t, int p);
+
+/**
+ * @brief Retorna el tamaño actual del array
+ * @tparam T Tipo de datos del array
+ * @tparam N Capacidad del almacenamiento interno
+ * @param a Referencia al array
+ * @return Cantidad de elementos en el array
+ */
+template<typename T, int N>
+int arraySize(SmallArray<T, N>& a);
+
+/**
+ * @brief Remueve y retorna el elemento en la posición especificada
+ * @tparam T Tipo de datos del array
+ * @tparam N Capacidad del almacenamiento interno
+ * @param a Referencia al array
+ * @param p Posición del elemento a remover
+ * @return Elemento removido
+ */
+template<typename T, int N>
+T arrayRemove(SmallArray<T, N>& a, int p);
+
+/**
+ * @brief Remueve todos los elementos del array
+ * @tparam T Tipo de datos del array
+ * @tparam N Capacidad del almacenamiento interno
+ * @param a Referencia al array
+ */
+template<typename T, int N>
+void arrayRemoveAll(SmallArray<T, N>& a);
+
+/**
+ * @brief Busca un elemento en el array usando una función de comparación
+ * @tparam T Tipo de datos del array
+ * @tparam N Capacidad del almacenamiento interno
+ * @tparam K Tipo de la clave de búsqueda
+ * @param a Referencia al array
+ * @param k Clave a buscar
+ * @param cmpTK Función de comparación entre T y K
+ * @return Índice del elemento encontrado o -1 si no se encuentra
+ */
+template<typename T, int N, typename K>
+int arrayFind(SmallArray<T, N>& a, K k, int cmpTK(T, K));
+
+/**
+ * @brief Busca un elemento en el array por igualdad
+ * @tparam T Tipo de datos del array
+ * @tparam N Capacidad del almacenamiento interno
+ * @param a Referencia al array
+ * @param k Elemento a buscar
+ * @return Índice del elemento encontrado o -1 si no se encuentra
+ */
+template<typename T, int N>
+int arrayFind(SmallArray<T, N>& a, T k);
+
+/**
+ * @brief Inserta un elemento manteniendo el orden del array
+ * @tparam T Tipo de datos del array
+ * @tparam N Capacidad del almacenamiento interno
+ * @param a Referencia al array
+ * @param t Elemento a insertar
+ * @param cmpTT Función de comparación entre elementos T
+ * @return Índice donde se insertó el elemento
+ */
+template<typename T, int N>
+int arrayOrderedInsert(SmallArray<T, N>& a, T t, int cmpTT(T, T));
+
+/**
+ * @brief Busca un elemento y lo agrega si no existe
+ * @tparam T Tipo de datos del array
+ * @tparam N Capacidad del almacenamiento interno
+ * @param a Referencia al array
+ * @param t Elemento a buscar/agregar
+ * @param cmpTT Función de comparación entre elementos T
+ * @return Puntero al elemento encontrado o agregado
+ */
+template<typename T, int N>
+T* arrayDiscover(SmallArray<T, N>& a, T t, int cmpTT(T, T));
+
+/**
+ * @brief Ordena el array usando una función de comparación
+ * @tparam T Tipo de datos del array
+ * @tparam N Capacidad del almacenamiento interno
+ * @param a Referencia al array
+ * @param cmpTT Función de comparación entre elementos T
+ */
+template<typename T, int N>
+void arraySort(SmallArray<T, N>& a, int cmpTT(T, T));
+
+#endif //SMALLARRAY_H
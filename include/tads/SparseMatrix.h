@@ -0,0 +1,172 @@
+/**
+ * @file SparseMatrix.h
+ * @brief Biblioteca de funciones para matrices dispersas con plantillas
+ *
+ * Esta biblioteca proporciona una matriz dispersa que sólo guarda las celdas distintas
+ * del valor por defecto. Se carga con ternas (fila, columna, valor) en formato COO y se
+ * compacta a formato CSR para las consultas, el recorrido por filas y el producto por
+ * un vector. Comparte con Matrix<T> la semántica de mtxGetAt y mtxSetAt.
+ */
+
+#ifndef SPARSEMATRIX_H
+#define SPARSEMATRIX_H
+
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Estructura que representa una matriz dispersa
+ * @tparam T Tipo de datos que almacena la matriz
+ *
+ * Las celdas compactadas viven en formato CSR (filas, cols, vals). Las ternas agregadas
+ * después de la última compactación quedan pendientes en formato COO hasta llamar a
+ * spmCompress. Las ternas pendientes se indexan por celda, así que cada celda aparece a lo
+ * sumo una vez entre ellas.
+ */
+template <typename T>
+struct SparseMatrix
+{
+   int f;                   ///< Número de filas
+   int c;                   ///< Número de columnas
+   T valorDefault;          ///< Valor de las celdas no almacenadas
+   std::vector<int> filas;  ///< CSR: inicio de cada fila en cols/vals (f + 1 posiciones)
+   std::vector<int> cols;   ///< CSR: columna de cada celda, ascendente dentro de la fila
+   std::vector<T> vals;     ///< CSR: valor de cada celda
+   std::vector<int> cooF;   ///< COO pendiente: fila de cada terna
+   std::vector<int> cooC;   ///< COO pendiente: columna de cada terna
+   std::vector<T> cooV;     ///< COO pendiente: valor de cada terna
+   std::unordered_map<long long, int> cooIdx;  ///< COO pendiente: posición de cada celda (f·c + columna)
+};
+
+/**
+ * @brief Vista de solo lectura sobre las celdas almacenadas de una fila
+ * @tparam T Tipo de datos de la matriz
+ */
+template <typename T>
+struct SparseRow
+{
+   const int* cols;  ///< Columnas de las celdas, en orden ascendente
+   const T* vals;    ///< Valores de las celdas
+   int len;          ///< Cantidad de celdas almacenadas en la fila
+};
+
+/**
+ * @brief Crea una matriz dispersa vacía
+ * @tparam T Tipo de datos de la matriz
+ * @param f Número de filas
+ * @param c Número de columnas
+ * @param valorDefault Valor de todas las celdas no almacenadas
+ * @return Nueva matriz dispersa
+ *
+ * @note No reserva memoria por celda: el costo es proporcional a f, no a f·c.
+ */
+template <typename T>
+SparseMatrix<T> sparseMatrix(int f, int c, T valorDefault);
+
+/**
+ * @brief Crea una matriz dispersa a partir de ternas COO y la compacta a CSR
+ * @tparam T Tipo de datos de la matriz
+ * @param f Número de filas
+ * @param c Número de columnas
+ * @param valorDefault Valor de todas las celdas no almacenadas
+ * @param fs Filas de las ternas
+ * @param cs Columnas de las ternas
+ * @param vs Valores de las ternas
+ * @param n Cantidad de ternas
+ * @return Nueva matriz dispersa compactada
+ *
+ * @note Si una celda se repite, prevalece la última terna.
+ */
+template <typename T>
+SparseMatrix<T> sparseMatrix(int f, int c, T valorDefault, const int fs[], const int cs[], const T vs[], int n);
+
+/**
+ * @brief Agrega una terna (fila, columna, valor) pendiente de compactar
+ * @tparam T Tipo de datos de la matriz
+ * @param m Referencia a la matriz
+ * @param f Fila
+ * @param c Columna
+ * @param v Valor
+ *
+ * @note Si la celda ya estaba pendiente se reemplaza su valor. O(1) amortizado.
+ */
+template <typename T>
+void spmAdd(SparseMatrix<T>& m, int f, int c, T v);
+
+/**
+ * @brief Compacta las ternas pendientes en el formato CSR
+ * @tparam T Tipo de datos de la matriz
+ * @param m Referencia a la matriz
+ *
+ * @note Las ternas se ordenan por (fila, columna) con un ordenamiento estable, de modo
+ * que ante celdas repetidas prevalece la última escrita. Complejidad O(n log n) sobre
+ * la cantidad total de celdas almacenadas.
+ */
+template <typename T>
+void spmCompress(SparseMatrix<T>& m);
+
+/**
+ * @brief Retorna la cantidad de celdas almacenadas (compactadas y pendientes)
+ * @tparam T Tipo de datos de la matriz
+ * @param m Matriz de referencia
+ * @return Cantidad de celdas almacenadas
+ */
+template <typename T>
+int spmSize(const SparseMatrix<T>& m);
+
+/**
+ * @brief Obtiene las celdas compactadas de una fila
+ * @tparam T Tipo de datos de la matriz
+ * @param m Matriz de referencia
+ * @param f Fila
+ * @return Vista sobre las columnas y valores almacenados de la fila
+ *
+ * @note No incluye las ternas pendientes; llamar antes a spmCompress. No está disponible
+ * para SparseMatrix<bool>, cuyos valores no se guardan como un array de bool; en ese
+ * caso usar mtxGetAt o una matriz de char.
+ */
+template <typename T>
+SparseRow<T> spmRow(const SparseMatrix<T>& m, int f);
+
+/**
+ * @brief Calcula el producto matriz-vector y = m·x
+ * @tparam T Tipo de datos de la matriz
+ * @param m Matriz compactada (sin ternas pendientes)
+ * @param x Vector de m.c elementos
+ * @param y Vector de m.f elementos donde se guarda el resultado
+ *
+ * @note Las celdas no almacenadas aportan valorDefault, de modo que el resultado
+ * coincide con el de la matriz densa equivalente.
+ */
+template <typename T>
+void spmMultiply(const SparseMatrix<T>& m, const T x[], T y[]);
+
+/**
+ * @brief Obtiene el elemento en la posición especificada
+ * @tparam T Tipo de datos de la matriz
+ * @param m Matriz de la cual obtener el elemento
+ * @param f Fila del elemento
+ * @param c Columna del elemento
+ * @return Elemento en la posición (f, c), o valorDefault si no está almacenado
+ *
+ * @note Las ternas pendientes se revisan primero en su índice, O(1); luego búsqueda
+ * binaria dentro de la fila CSR.
+ */
+template <typename T>
+T mtxGetAt(const SparseMatrix<T>& m, int f, int c);
+
+/**
+ * @brief Establece el valor del elemento en la posición especificada
+ * @tparam T Tipo de datos de la matriz
+ * @param m Referencia a la matriz a modificar
+ * @param t Valor a establecer
+ * @param f Fila del elemento
+ * @param c Columna del elemento
+ *
+ * @note Si la celda ya está pendiente o compactada se sobrescribe en su lugar; si no, queda
+ * pendiente como terna COO hasta la próxima compactación. O(log n) por llamada.
+ */
+template <typename T>
+void mtxSetAt(SparseMatrix<T>& m, T t, int f, int c);
+
+#endif //SPARSEMATRIX_H
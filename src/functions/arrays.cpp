@@ -1,29 +1,47 @@
 #include "../../include/functions/arrays.h"
 
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define ARRAYS_SIMD_X86
+#include <immintrin.h>
+#endif
+
 template<typename T>
 int add(T arr[], int &len, T e) {
-    arr[len++] = e;
+    arr[len++] = std::move(e);
     return len;
 }
 
 template<typename T>
 void insert(T arr[], int &len, T e, int p) {
-    T aux = arr[p];
-    arr[p++] = e;
-    while (p < len + 1) {
-        e = aux;
-        aux = arr[p];
-        arr[p++] = e;
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        std::memmove(arr + p + 1, arr + p, (len - p) * sizeof(T));
+    } else {
+        for (int i = len; i > p; i--) {
+            arr[i] = std::move(arr[i - 1]);
+        }
     }
+    arr[p] = std::move(e);
     len++;
 }
 
 template<typename T>
 T remove(T arr[], int &len, int p) {
-    T ret = arr[p];
-    while (p < len - 1) {
-        arr[p] = arr[p + 1];
-        p++;
+    T ret = std::move(arr[p]);
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        std::memmove(arr + p, arr + p + 1, (len - p - 1) * sizeof(T));
+    } else {
+        while (p < len - 1) {
+            arr[p] = std::move(arr[p + 1]);
+            p++;
+        }
     }
     len--;
     return ret;
@@ -40,27 +58,464 @@ int find(T arr[], int len, K k, int cmpTK(T, K)) {
 }
 
 template<typename T>
-int orderedInsert(T arr[], int &len, T e, int cmpTT(T, T)) {
-    int p = 0;
-    while (cmpTT(arr[p], e) < 0) {
-        p++;
+int removeIf(T arr[], int &len, bool pred(T)) {
+    int k = 0;
+    for (int i = 0; i < len; i++) {
+        if (!pred(arr[i])) {
+            if (k != i) {
+                arr[k] = std::move(arr[i]);
+            }
+            k++;
+        }
+    }
+    const int removidos = len - k;
+    len = k;
+    return removidos;
+}
+
+template<typename T>
+int _findScalar(T arr[], int d, int len, T k) {
+    for (int i = d; i < len; i++) {
+        if (!(arr[i] < k) && !(k < arr[i])) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+#ifdef ARRAYS_SIMD_X86
+template<typename T>
+__attribute__((target("sse2"))) int _findSse2(T arr[], int len, T k) {
+    int i = 0;
+    if constexpr (std::is_same<T, float>::value) {
+        const __m128 vk = _mm_set1_ps(k);
+        for (; i + 4 <= len; i += 4) {
+            const __m128 v = _mm_loadu_ps(arr + i);
+            const int m = _mm_movemask_ps(_mm_or_ps(_mm_cmpeq_ps(v, vk), _mm_cmpunord_ps(v, vk)));
+            if (m != 0) {
+                return i + __builtin_ctz(m);
+            }
+        }
+    } else if constexpr (std::is_same<T, double>::value) {
+        const __m128d vk = _mm_set1_pd(k);
+        for (; i + 2 <= len; i += 2) {
+            const __m128d v = _mm_loadu_pd(arr + i);
+            const int m = _mm_movemask_pd(_mm_or_pd(_mm_cmpeq_pd(v, vk), _mm_cmpunord_pd(v, vk)));
+            if (m != 0) {
+                return i + __builtin_ctz(m);
+            }
+        }
+    } else {
+        const int n = 16 / sizeof(T);
+        __m128i vk;
+        if constexpr (sizeof(T) == 1) {
+            vk = _mm_set1_epi8((char) k);
+        } else if constexpr (sizeof(T) == 2) {
+            vk = _mm_set1_epi16((short) k);
+        } else if constexpr (sizeof(T) == 4) {
+            vk = _mm_set1_epi32((int) k);
+        } else {
+            vk = _mm_set1_epi64x((long long) k);
+        }
+        for (; i + n <= len; i += n) {
+            const __m128i v = _mm_loadu_si128((const __m128i*) (arr + i));
+            __m128i c;
+            if constexpr (sizeof(T) == 1) {
+                c = _mm_cmpeq_epi8(v, vk);
+            } else if constexpr (sizeof(T) == 2) {
+                c = _mm_cmpeq_epi16(v, vk);
+            } else if constexpr (sizeof(T) == 4) {
+                c = _mm_cmpeq_epi32(v, vk);
+            } else {
+                // SSE2 no compara de a 64 bits: ambas mitades de 32 bits deben coincidir
+                c = _mm_cmpeq_epi32(v, vk);
+                c = _mm_and_si128(c, _mm_shuffle_epi32(c, _MM_SHUFFLE(2, 3, 0, 1)));
+            }
+            const int m = _mm_movemask_epi8(c);
+            if (m != 0) {
+                return i + __builtin_ctz(m) / sizeof(T);
+            }
+        }
     }
-    insert<T>(arr, len, e, p);
+    return _findScalar<T>(arr, i, len, k);
+}
+
+template<typename T>
+__attribute__((target("avx2"))) int _findAvx2(T arr[], int len, T k) {
+    int i = 0;
+    if constexpr (std::is_same<T, float>::value) {
+        const __m256 vk = _mm256_set1_ps(k);
+        for (; i + 8 <= len; i += 8) {
+            const __m256 v = _mm256_loadu_ps(arr + i);
+            const int m = _mm256_movemask_ps(_mm256_cmp_ps(v, vk, _CMP_EQ_UQ));
+            if (m != 0) {
+                return i + __builtin_ctz(m);
+            }
+        }
+    } else if constexpr (std::is_same<T, double>::value) {
+        const __m256d vk = _mm256_set1_pd(k);
+        for (; i + 4 <= len; i += 4) {
+            const __m256d v = _mm256_loadu_pd(arr + i);
+            const int m = _mm256_movemask_pd(_mm256_cmp_pd(v, vk, _CMP_EQ_UQ));
+            if (m != 0) {
+                return i + __builtin_ctz(m);
+            }
+        }
+    } else {
+        const int n = 32 / sizeof(T);
+        __m256i vk;
+        if constexpr (sizeof(T) == 1) {
+            vk = _mm256_set1_epi8((char) k);
+        } else if constexpr (sizeof(T) == 2) {
+            vk = _mm256_set1_epi16((short) k);
+        } else if constexpr (sizeof(T) == 4) {
+            vk = _mm256_set1_epi32((int) k);
+        } else {
+            vk = _mm256_set1_epi64x((long long) k);
+        }
+        for (; i + n <= len; i += n) {
+            const __m256i v = _mm256_loadu_si256((const __m256i*) (arr + i));
+            __m256i c;
+            if constexpr (sizeof(T) == 1) {
+                c = _mm256_cmpeq_epi8(v, vk);
+            } else if constexpr (sizeof(T) == 2) {
+                c = _mm256_cmpeq_epi16(v, vk);
+            } else if constexpr (sizeof(T) == 4) {
+                c = _mm256_cmpeq_epi32(v, vk);
+            } else {
+                c = _mm256_cmpeq_epi64(v, vk);
+            }
+            const unsigned m = (unsigned) _mm256_movemask_epi8(c);
+            if (m != 0) {
+                return i + __builtin_ctz(m) / sizeof(T);
+            }
+        }
+    }
+    return _findScalar<T>(arr, i, len, k);
+}
+#endif
+
+template<typename T>
+int find(T arr[], int len, T k) {
+#ifdef ARRAYS_SIMD_X86
+    constexpr bool vectorizable = std::is_same<T, float>::value || std::is_same<T, double>::value
+                                  || (std::is_integral<T>::value
+                                      && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8));
+    if constexpr (vectorizable) {
+        static const bool avx2 = __builtin_cpu_supports("avx2");
+        static const bool sse2 = __builtin_cpu_supports("sse2");
+        if (avx2) {
+            return _findAvx2<T>(arr, len, k);
+        }
+        if (sse2) {
+            return _findSse2<T>(arr, len, k);
+        }
+    }
+#endif
+    return _findScalar<T>(arr, 0, len, k);
+}
+
+template<typename T, typename K>
+int lowerBound(T arr[], int len, K k, int cmpTK(T, K)) {
+    int d = 0;
+    int h = len;
+    while (d < h) {
+        const int m = d + (h - d) / 2;
+        if (cmpTK(arr[m], k) < 0) {
+            d = m + 1;
+        } else {
+            h = m;
+        }
+    }
+    return d;
+}
+
+template<typename T, typename K>
+int upperBound(T arr[], int len, K k, int cmpTK(T, K)) {
+    int d = 0;
+    int h = len;
+    while (d < h) {
+        const int m = d + (h - d) / 2;
+        if (cmpTK(arr[m], k) <= 0) {
+            d = m + 1;
+        } else {
+            h = m;
+        }
+    }
+    return d;
+}
+
+template<typename T, typename K>
+int binaryFind(T arr[], int len, K k, int cmpTK(T, K)) {
+    const int p = lowerBound<T, K>(arr, len, k, cmpTK);
+    if (p < len && cmpTK(arr[p], k) == 0) {
+        return p;
+    }
+    return -1;
+}
+
+template<typename T>
+int orderedInsert(T arr[], int &len, T e, int cmpTT(T, T)) {
+    const int p = lowerBound<T, T>(arr, len, e, cmpTT);
+    insert<T>(arr, len, std::move(e), p);
     return p;
 }
 
+template<typename T, typename Cmp>
+void _insertionSort(T arr[], int d, int h, Cmp cmpTT) {
+    for (int i = d + 1; i < h; i++) {
+        T x = std::move(arr[i]);
+        int j = i;
+        while (j > d && cmpTT(x, arr[j - 1]) < 0) {
+            arr[j] = std::move(arr[j - 1]);
+            j--;
+        }
+        arr[j] = std::move(x);
+    }
+}
+
+template<typename T, typename Cmp>
+void _siftDown(T arr[], int i, int len, Cmp cmpTT) {
+    T x = std::move(arr[i]);
+    while (2 * i + 1 < len) {
+        int c = 2 * i + 1;
+        if (c + 1 < len && cmpTT(arr[c], arr[c + 1]) < 0) {
+            c++;
+        }
+        if (cmpTT(x, arr[c]) >= 0) {
+            break;
+        }
+        arr[i] = std::move(arr[c]);
+        i = c;
+    }
+    arr[i] = std::move(x);
+}
+
+template<typename T, typename Cmp>
+void _heapSort(T arr[], int len, Cmp cmpTT) {
+    for (int i = len / 2 - 1; i >= 0; i--) {
+        _siftDown<T>(arr, i, len, cmpTT);
+    }
+    for (int i = len - 1; i > 0; i--) {
+        std::swap(arr[0], arr[i]);
+        _siftDown<T>(arr, 0, i, cmpTT);
+    }
+}
+
+template<typename T, typename Cmp>
+void _introSort(T arr[], int d, int h, int depth, Cmp cmpTT) {
+    while (h - d > 16) {
+        if (depth == 0) {
+            _heapSort<T>(arr + d, h - d, cmpTT);
+            return;
+        }
+        depth--;
+
+        // mediana de tres: deja arr[d] <= arr[m] <= arr[h - 1] como centinelas
+        const int m = d + (h - d) / 2;
+        if (cmpTT(arr[m], arr[d]) < 0) {
+            std::swap(arr[m], arr[d]);
+        }
+        if (cmpTT(arr[h - 1], arr[m]) < 0) {
+            std::swap(arr[h - 1], arr[m]);
+            if (cmpTT(arr[m], arr[d]) < 0) {
+                std::swap(arr[m], arr[d]);
+            }
+        }
+        const T pivot = arr[m];
+
+        int i = d;
+        int j = h - 1;
+        while (true) {
+            do {
+                i++;
+            } while (cmpTT(arr[i], pivot) < 0);
+            do {
+                j--;
+            } while (cmpTT(pivot, arr[j]) < 0);
+            if (i >= j) {
+                break;
+            }
+            std::swap(arr[i], arr[j]);
+        }
+
+        // recursión sobre la parte menor para acotar la pila a O(log n)
+        if (i - d < h - i) {
+            _introSort<T>(arr, d, i, depth, cmpTT);
+            d = i;
+        } else {
+            _introSort<T>(arr, i, h, depth, cmpTT);
+            h = i;
+        }
+    }
+    _insertionSort<T>(arr, d, h, cmpTT);
+}
+
 template<typename T>
 void sort(T arr[], int len, int cmpTT(T, T)) {
-    bool seInvirtio = true;
-    while (seInvirtio) {
-        seInvirtio = false;
-        for (int i = 1; i < len; i++) {
-            if (cmpTT(arr[i], arr[i - 1]) < 0) {
-                T aux = arr[i - 1];
-                arr[i - 1] = arr[i];
-                arr[i] = aux;
-                seInvirtio = true;
+    int depth = 0;
+    for (int n = len; n > 1; n /= 2) {
+        depth += 2;
+    }
+    _introSort<T>(arr, 0, len, depth, cmpTT);
+}
+
+template<typename T, typename Cmp>
+void _merge(T a[], int na, T b[], int nb, T dst[], Cmp cmpTT) {
+    int i = 0;
+    int j = 0;
+    int k = 0;
+    while (i < na && j < nb) {
+        if (cmpTT(b[j], a[i]) < 0) {
+            dst[k++] = std::move(b[j++]);
+        } else {
+            dst[k++] = std::move(a[i++]);
+        }
+    }
+    while (i < na) {
+        dst[k++] = std::move(a[i++]);
+    }
+    while (j < nb) {
+        dst[k++] = std::move(b[j++]);
+    }
+}
+
+template<typename T, typename Cmp>
+void _stableSort(T arr[], int len, Cmp cmpTT) {
+    const int run = 32;
+    for (int d = 0; d < len; d += run) {
+        _insertionSort<T>(arr, d, d + run < len ? d + run : len, cmpTT);
+    }
+    if (len <= run) {
+        return;
+    }
+
+    T* aux = std::allocator<T>().allocate(len);
+    std::uninitialized_move(arr, arr + len, aux);
+    T* src = aux;
+    T* dst = arr;
+    for (int w = run; w < len; w *= 2) {
+        for (int d = 0; d < len; d += 2 * w) {
+            const int m = d + w < len ? d + w : len;
+            const int h = d + 2 * w < len ? d + 2 * w : len;
+            _merge<T>(src + d, m - d, src + m, h - m, dst + d, cmpTT);
+        }
+        std::swap(src, dst);
+    }
+    if (src != arr) {
+        for (int i = 0; i < len; i++) {
+            arr[i] = std::move(src[i]);
+        }
+    }
+    std::destroy(aux, aux + len);
+    std::allocator<T>().deallocate(aux, len);
+}
+
+template<typename T>
+void stableSort(T arr[], int len, int cmpTT(T, T)) {
+    _stableSort<T>(arr, len, cmpTT);
+}
+
+template<typename T, typename Cmp>
+void stableSortBy(T arr[], int len, Cmp cmpTT) {
+    _stableSort<T>(arr, len, cmpTT);
+}
+
+template<typename T, typename Cmp>
+int _coRank(T a[], int na, T b[], int nb, int k, Cmp cmpTT) {
+    // cantidad de elementos de a entre los primeros k del merge estable de a y b
+    int lo = k > nb ? k - nb : 0;
+    int hi = k < na ? k : na;
+    while (lo < hi) {
+        const int i = lo + (hi - lo) / 2;
+        const int j = k - i;
+        if (j > 0 && cmpTT(b[j - 1], a[i]) >= 0) {
+            lo = i + 1;
+        } else {
+            hi = i;
+        }
+    }
+    return lo;
+}
+
+template<typename T>
+void parallelSort(T arr[], int len, int cmpTT(T, T), int threads) {
+    if (threads <= 0) {
+        threads = (int) std::thread::hardware_concurrency();
+    }
+    if (threads > len / 1024) {
+        threads = len / 1024;
+    }
+    if (threads <= 1) {
+        stableSort<T>(arr, len, cmpTT);
+        return;
+    }
+
+    std::vector<int> bnd(threads + 1);
+    for (int i = 0; i <= threads; i++) {
+        bnd[i] = (int) ((long long) len * i / threads);
+    }
+
+    // cada hilo ordena su bloque y lo mueve al buffer auxiliar
+    T* aux = std::allocator<T>().allocate(len);
+    std::vector<std::thread> th;
+    for (int i = 0; i < threads; i++) {
+        th.emplace_back([=, &bnd] {
+            stableSort<T>(arr + bnd[i], bnd[i + 1] - bnd[i], cmpTT);
+            std::uninitialized_move(arr + bnd[i], arr + bnd[i + 1], aux + bnd[i]);
+        });
+    }
+    for (std::thread& t: th) {
+        t.join();
+    }
+
+    // merges por pares de bloques; cada merge se reparte entre varios hilos
+    T* src = aux;
+    T* dst = arr;
+    for (int w = 1; w < threads; w *= 2) {
+        th.clear();
+        for (int d = 0; d < threads; d += 2 * w) {
+            const int lo = bnd[d];
+            const int mid = bnd[d + w < threads ? d + w : threads];
+            const int hi = bnd[d + 2 * w < threads ? d + 2 * w : threads];
+            const int parts = 2 * w < threads - d ? 2 * w : threads - d;
+            T* a = src + lo;
+            T* b = src + mid;
+            const int na = mid - lo;
+            const int nb = hi - mid;
+            // los cortes se calculan antes de lanzar los hilos porque el merge mueve src
+            std::vector<int> cut(parts + 1);
+            for (int q = 0; q <= parts; q++) {
+                const int k = (int) ((long long) (na + nb) * q / parts);
+                cut[q] = _coRank<T>(a, na, b, nb, k, cmpTT);
             }
+            for (int q = 0; q < parts; q++) {
+                const int k0 = (int) ((long long) (na + nb) * q / parts);
+                const int k1 = (int) ((long long) (na + nb) * (q + 1) / parts);
+                const int i0 = cut[q];
+                const int i1 = cut[q + 1];
+                th.emplace_back([=] {
+                    _merge<T>(a + i0, i1 - i0, b + k0 - i0, (k1 - i1) - (k0 - i0), dst + lo + k0, cmpTT);
+                });
+            }
+        }
+        for (std::thread& t: th) {
+            t.join();
         }
+        std::swap(src, dst);
+    }
+
+    th.clear();
+    for (int i = 0; i < threads; i++) {
+        th.emplace_back([=, &bnd] {
+            if (src != arr) {
+                std::move(src + bnd[i], src + bnd[i + 1], arr + bnd[i]);
+            }
+            std::destroy(aux + bnd[i], aux + bnd[i + 1]);
+        });
+    }
+    for (std::thread& t: th) {
+        t.join();
     }
+    std::allocator<T>().deallocate(aux, len);
 }
@@ -1,5 +1,33 @@
 #include "../../include/functions/files.h"
 
+#if defined(__unix__) || defined(__APPLE__)
+#define FILES_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// fseek y ftell con desplazamientos de 64 bits aunque long sea de 32 bits
+int _fileSeek(FILE *f, long long off, int origen) {
+#if defined(_WIN32)
+    return _fseeki64(f, off, origen);
+#elif defined(__unix__) || defined(__APPLE__)
+    return fseeko(f, (off_t) off, origen);
+#else
+    return fseek(f, (long) off, origen);
+#endif
+}
+
+long long _fileTell(FILE *f) {
+#if defined(_WIN32)
+    return _ftelli64(f);
+#elif defined(__unix__) || defined(__APPLE__)
+    return (long long) ftello(f);
+#else
+    return ftell(f);
+#endif
+}
 
 template<typename T>
 void write(FILE *f, T t) {
@@ -16,20 +44,90 @@ T read(FILE *f) {
 }
 
 template<typename T>
-void seek(FILE *f, int n) {
-    fseek(f, n * sizeof(T), SEEK_SET);
+int writeBlock(FILE *f, const T arr[], int n) {
+    fseek(f, 0, SEEK_CUR);
+    return (int) fwrite(arr, sizeof(T), n, f);
+}
+
+template<typename T>
+int readBlock(FILE *f, T arr[], int n) {
+    fseek(f, 0, SEEK_CUR);
+    return (int) fread(arr, sizeof(T), n, f);
+}
+
+template<typename T>
+bool seek(FILE *f, long long n) {
+    return _fileSeek(f, n * (long long) sizeof(T), SEEK_SET) == 0;
 }
 
 template<typename T>
 int fileSize(FILE *f) {
-    const int aux = ftell(f);
-    fseek(f, 0, SEEK_END);
-    const int i = (int) ftell(f) / sizeof(T);
-    fseek(f, aux, SEEK_SET);
+    const long long aux = _fileTell(f);
+    _fileSeek(f, 0, SEEK_END);
+    const int i = (int) (_fileTell(f) / (long long) sizeof(T));
+    _fileSeek(f, aux, SEEK_SET);
     return i;
 }
 
 template<typename T>
 int filePos(FILE *f) {
-    return (int) ftell(f) / sizeof(T);
+    return (int) (_fileTell(f) / (long long) sizeof(T));
+}
+
+#ifdef FILES_MMAP
+FileMap fileMap(const char *path, bool escritura, long len) {
+    FileMap m = {NULL, 0, escritura};
+    const int fd = open(path, escritura ? O_RDWR | O_CREAT : O_RDONLY, 0644);
+    if (fd < 0) {
+        return m;
+    }
+    if (escritura) {
+        if (ftruncate(fd, len) != 0) {
+            close(fd);
+            return m;
+        }
+    } else {
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            close(fd);
+            return m;
+        }
+        len = (long) st.st_size;
+    }
+    if (len > 0) {
+        void *p = mmap(NULL, len, escritura ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+        if (p != MAP_FAILED) {
+            m.data = (unsigned char *) p;
+            m.len = len;
+        }
+    } else {
+        // mmap no admite 0 bytes: un archivo vacío se representa sin proyección
+        static unsigned char vacio;
+        m.data = &vacio;
+    }
+    // la proyección sigue vigente después de cerrar el descriptor
+    close(fd);
+    return m;
+}
+
+void fileUnmap(FileMap &m) {
+    if (m.data != NULL && m.len > 0) {
+        if (m.escritura) {
+            msync(m.data, m.len, MS_SYNC);
+        }
+        munmap(m.data, m.len);
+    }
+    m.data = NULL;
+    m.len = 0;
+}
+#else
+FileMap fileMap(const char *, bool escritura, long) {
+    FileMap m = {NULL, 0, escritura};
+    return m;
+}
+
+void fileUnmap(FileMap &m) {
+    m.data = NULL;
+    m.len = 0;
 }
+#endif
@@ -27,6 +27,22 @@ std::string getTokenAt(const std::string &s, const char sep, const int i) {
     return p;
 }
 
+std::string_view getTokenViewAt(const std::string_view s, const char sep, const int i) {
+    if (s.empty()) {
+        return {};
+    }
+    std::string_view::size_type d = 0;
+    for (int n = 0; n < i; n++) {
+        d = s.find(sep, d);
+        if (d == std::string_view::npos) {
+            return {};
+        }
+        d++;
+    }
+    const std::string_view::size_type h = s.find(sep, d);
+    return s.substr(d, h == std::string_view::npos ? std::string_view::npos : h - d);
+}
+
 void removeTokenAt(std::string &s, const char sep, const int i) {
     s = cpad(s, length(s) + 2, sep);
     const int d = indexOfN(s, sep, i + 1);
@@ -48,14 +64,13 @@ void setTokenAt(std::string &s, const char sep, const std::string &t, const int
     }
 }
 
-int findToken(std::string s, const char sep, const std::string &t) {
-    s = cpad(s, length(s) + 2, sep);
-    const int i = indexOf(s, sep + t + sep);
+int findToken(const std::string &s, const char sep, const std::string &t) {
+    const std::string u = cpad(s, length(s) + 2, sep);
+    const int i = indexOf(u, sep + t + sep);
     if (i == -1) {
         return -1;
     }
-    const std::string u = substring(s, 0, i + 1);
-    return charCount(u, sep) - 1;
+    return charCount(substring(u, 0, i + 1), sep) - 1;
 }
 
 std::string emptyTString(const int x, const char sep) {
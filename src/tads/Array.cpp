@@ -1,12 +1,54 @@
 #include "../../include/tads/Array.h"
 
+#include "../../include/functions/arrays.h"
+#include <cstring>
+#include <functional>
 #include <iostream>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template<typename T>
+T* _arrayAlloc(int cap)
+{
+    return std::allocator<T>().allocate(cap);
+}
+
+template<typename T>
+void _arrayFree(T* arr, int cap)
+{
+    std::allocator<T>().deallocate(arr, cap);
+}
+
+// indica si arr apunta a elementos del propio array
+template<typename T>
+bool _arrayAliases(const Array<T>& a, const T* arr)
+{
+    return std::less_equal<const T*>()(a.arr, arr) && std::less<const T*>()(arr, a.arr + a.len);
+}
+
+// copia n elementos a un buffer propio, para cuando el origen pertenece al array
+template<typename T>
+T* _arrayClone(const T* arr, int n)
+{
+    T* copia = _arrayAlloc<T>(n);
+    std::uninitialized_copy(arr, arr + n, copia);
+    return copia;
+}
+
+template<typename T>
+void _arrayFreeClone(T* copia, int n)
+{
+    std::destroy(copia, copia + n);
+    _arrayFree<T>(copia, n);
+}
 
 template<typename T>
 Array<T> arrayCreate()
 {
     Array<T> a;
-    T* p = new T[20];
+    T* p = _arrayAlloc<T>(20);
     a.arr = p;
     a.len = 0;
     a.cap = 20;
@@ -16,14 +58,70 @@ Array<T> arrayCreate()
 template<typename T>
 void redimensionar(Array<T>& a)
 {
-    T* nuevoArr = new T[a.cap + 1];
-    for(int i = 0; i < a.len; i++)
+    int cap = (int)(a.cap * ARRAY_GROWTH_FACTOR);
+    if(cap <= a.cap)
     {
-        nuevoArr[i] = a.arr[i];
+        cap = a.cap + 1;
     }
-    delete[] a.arr;
+    redimensionar<T>(a, cap);
+}
+
+template<typename T>
+void redimensionar(Array<T>& a, int cap)
+{
+    T* nuevoArr = _arrayAlloc<T>(cap);
+    if constexpr(std::is_trivially_copyable<T>::value)
+    {
+        if(a.len > 0)
+        {
+            std::memcpy(nuevoArr, a.arr, a.len * sizeof(T));
+        }
+    }
+    else
+    {
+        for(int i = 0; i < a.len; i++)
+        {
+            new(nuevoArr + i) T(std::move(a.arr[i]));
+            a.arr[i].~T();
+        }
+    }
+    _arrayFree<T>(a.arr, a.cap);
     a.arr = nuevoArr;
-    a.cap++;
+    a.cap = cap;
+}
+
+template<typename T>
+void _arrayGrow(Array<T>& a, int n)
+{
+    if(n > a.cap)
+    {
+        const int cap = (int)(a.cap * ARRAY_GROWTH_FACTOR);
+        redimensionar<T>(a, cap > n ? cap : n);
+    }
+}
+
+template<typename T>
+void arrayReserve(Array<T>& a, int n)
+{
+    if(n > a.cap)
+    {
+        redimensionar<T>(a, n);
+    }
+}
+
+template<typename T>
+void arrayShrinkToFit(Array<T>& a)
+{
+    if(a.len < a.cap)
+    {
+        redimensionar<T>(a, a.len);
+    }
+}
+
+template<typename T>
+int arrayCapacity(Array<T> a)
+{
+    return a.cap;
 }
 
 template<typename T>
@@ -33,7 +131,60 @@ int arrayAdd(Array<T>& a, T t)
     {
         redimensionar<T>(a);
     }
-    add<T>(a.arr, a.len, t);
+    new(a.arr + a.len) T(std::move(t));
+    a.len++;
+    return a.len - 1;
+}
+
+template<typename T>
+int arrayAddAll(Array<T>& a, const T* arr, int n)
+{
+    if(n > 0 && _arrayAliases<T>(a, arr))
+    {
+        // el origen se libera al crecer: se copia antes
+        T* copia = _arrayClone<T>(arr, n);
+        const int p = arrayAddAll<T>(a, copia, n);
+        _arrayFreeClone<T>(copia, n);
+        return p;
+    }
+    const int p = a.len;
+    _arrayGrow<T>(a, a.len + n);
+    if constexpr(std::is_trivially_copyable<T>::value)
+    {
+        if(n > 0)
+        {
+            std::memcpy(a.arr + a.len, arr, n * sizeof(T));
+        }
+    }
+    else
+    {
+        std::uninitialized_copy(arr, arr + n, a.arr + a.len);
+    }
+    a.len += n;
+    return p;
+}
+
+template<typename T>
+int arrayAddAll(Array<T>& a, Array<T> b)
+{
+    return arrayAddAll<T>(a, b.arr, b.len);
+}
+
+template<typename T, typename... Args>
+int arrayEmplace(Array<T>& a, Args&&... args)
+{
+    if(a.len == a.cap)
+    {
+        // los argumentos podrían referenciar elementos del propio array
+        T t(std::forward<Args>(args)...);
+        redimensionar<T>(a);
+        new(a.arr + a.len) T(std::move(t));
+    }
+    else
+    {
+        new(a.arr + a.len) T(std::forward<Args>(args)...);
+    }
+    a.len++;
     return a.len - 1;
 }
 
@@ -47,7 +198,7 @@ template<typename T>
 void arraySet(Array<T>& a, int p, T t)
 {
     T* e = arrayGet<T>(a, p);
-    *e = t;
+    *e = std::move(t);
 }
 
 template<typename T>
@@ -57,7 +208,67 @@ void arrayInsert(Array<T>& a, T t, int p)
     {
         redimensionar<T>(a);
     }
-    insert<T>(a.arr, a.len, t, p);
+    if(p == a.len)
+    {
+        new(a.arr + a.len) T(std::move(t));
+        a.len++;
+        return;
+    }
+    // construye la posición libre con el último elemento y desplaza el resto
+    new(a.arr + a.len) T(std::move(a.arr[a.len - 1]));
+    int len = a.len - 1;
+    insert<T>(a.arr, len, std::move(t), p);
+    a.len++;
+}
+
+template<typename T>
+void arrayInsertRange(Array<T>& a, const T* arr, int n, int p)
+{
+    if(n <= 0)
+    {
+        return;
+    }
+    if(_arrayAliases<T>(a, arr))
+    {
+        // el origen se libera al crecer y se desplaza al abrir el hueco: se copia antes
+        T* copia = _arrayClone<T>(arr, n);
+        arrayInsertRange<T>(a, copia, n, p);
+        _arrayFreeClone<T>(copia, n);
+        return;
+    }
+    _arrayGrow<T>(a, a.len + n);
+    if constexpr(std::is_trivially_copyable<T>::value)
+    {
+        std::memmove(a.arr + p + n, a.arr + p, (a.len - p) * sizeof(T));
+        std::memcpy(a.arr + p, arr, n * sizeof(T));
+    }
+    else
+    {
+        // las posiciones desde a.len en adelante no están construidas
+        for(int i = a.len - 1; i >= p; i--)
+        {
+            if(i + n >= a.len)
+            {
+                new(a.arr + i + n) T(std::move(a.arr[i]));
+            }
+            else
+            {
+                a.arr[i + n] = std::move(a.arr[i]);
+            }
+        }
+        for(int j = 0; j < n; j++)
+        {
+            if(p + j < a.len)
+            {
+                a.arr[p + j] = arr[j];
+            }
+            else
+            {
+                new(a.arr + p + j) T(arr[j]);
+            }
+        }
+    }
+    a.len += n;
 }
 
 template<typename T>
@@ -70,12 +281,35 @@ template<typename T>
 T arrayRemove(Array<T>& a, int p)
 {
     T t = remove<T>(a.arr, a.len, p);
+    a.arr[a.len].~T();
     return t;
 }
 
+template<typename T>
+int arrayRemoveIf(Array<T>& a, bool pred(T))
+{
+    const int len = a.len;
+    const int removidos = removeIf<T>(a.arr, a.len, pred);
+    if constexpr(!std::is_trivially_destructible<T>::value)
+    {
+        for(int i = a.len; i < len; i++)
+        {
+            a.arr[i].~T();
+        }
+    }
+    return removidos;
+}
+
 template<typename T>
 void arrayRemoveAll(Array<T>& a)
 {
+    if constexpr(!std::is_trivially_destructible<T>::value)
+    {
+        for(int i = 0; i < a.len; i++)
+        {
+            a.arr[i].~T();
+        }
+    }
     a.len = 0;
 }
 
@@ -85,14 +319,36 @@ int arrayFind(Array<T> a, K k, int cmpTK(T, K))
     return find<T, K>(a.arr, a.len, k, cmpTK);
 }
 
+template<typename T>
+int arrayFind(Array<T> a, T k)
+{
+    return find<T>(a.arr, a.len, k);
+}
+
+template<typename T, typename K>
+int arrayBinaryFind(Array<T> a, K k, int cmpTK(T, K))
+{
+    return binaryFind<T, K>(a.arr, a.len, k, cmpTK);
+}
+
+template<typename T, typename K>
+int arrayLowerBound(Array<T> a, K k, int cmpTK(T, K))
+{
+    return lowerBound<T, K>(a.arr, a.len, k, cmpTK);
+}
+
+template<typename T, typename K>
+int arrayUpperBound(Array<T> a, K k, int cmpTK(T, K))
+{
+    return upperBound<T, K>(a.arr, a.len, k, cmpTK);
+}
+
 template<typename T>
 int arrayOrderedInsert(Array<T>& a, T t, int cmpTT(T, T))
 {
-    if(a.len == a.cap)
-    {
-        redimensionar<T>(a);
-    }
-    return orderedInsert<T>(a.arr, a.len, t, cmpTT);
+    const int p = arrayLowerBound<T, T>(a, t, cmpTT);
+    arrayInsert<T>(a, std::move(t), p);
+    return p;
 }
 
 template<typename T>
@@ -112,6 +368,18 @@ void arraySort(Array<T>& a, int cmpTT(T, T))
     sort<T>(a.arr, a.len, cmpTT);
 }
 
+template<typename T>
+void arrayStableSort(Array<T>& a, int cmpTT(T, T))
+{
+    stableSort<T>(a.arr, a.len, cmpTT);
+}
+
+template<typename T>
+void arrayParallelSort(Array<T>& a, int cmpTT(T, T), int threads)
+{
+    parallelSort<T>(a.arr, a.len, cmpTT, threads);
+}
+
 template<typename T>
 void mostrarArray(Array<T> arr)
 {
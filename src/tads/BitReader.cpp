@@ -1,26 +1,151 @@
 #include "../../include/tads/BitReader.h"
 
-#include "../../include/functions/files.h"
 #include "../../include/functions/conversions.h"
-#include <cmath>
+#include <cstring>
 
 BitReader bitReader(FILE* f)
 {
-    return {f, 0, 0};
+    BitReader br;
+    br.f = f;
+    br.mem = NULL;
+    br.buf.resize(BITREADER_BUFFER);
+    br.off = 0;
+    br.len = 0;
+    br.fin = false;
+    br.acc = 0;
+    br.nbits = 0;
+    return br;
+}
+
+BitReader bitReader(const unsigned char* data, long long len)
+{
+    BitReader br;
+    br.f = NULL;
+    br.mem = data;
+    br.off = 0;
+    br.len = len;
+    br.fin = true;
+    br.acc = 0;
+    br.nbits = 0;
+    return br;
+}
+
+// conserva los bytes sin cargar al inicio del buffer y lo completa desde el archivo
+void _bitReaderFill(BitReader& br)
+{
+    const int resto = (int)(br.len - br.off);
+    memmove(br.buf.data(), br.buf.data() + br.off, resto);
+    br.off = 0;
+    br.len = resto;
+    const size_t n = fread(br.buf.data() + br.len, 1, br.buf.size() - br.len, br.f);
+    br.len += (long long)n;
+    br.fin = n == 0;
+}
+
+uint64_t _bitReaderLoad64(const unsigned char* p)
+{
+    uint64_t x;
+    memcpy(&x, p, 8);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    x = __builtin_bswap64(x);
+#elif !defined(__BYTE_ORDER__)
+    x = 0;
+    for(int i = 0; i < 8; i++)
+    {
+        x = x << 8 | p[i];
+    }
+#endif
+    return x;
+}
+
+// deja al menos 57 bits en el acumulador, salvo que el archivo no tenga tantos;
+// se llama sólo con nbits <= 56
+void _bitReaderRefill(BitReader& br)
+{
+    if(br.off + 8 > br.len && !br.fin)
+    {
+        _bitReaderFill(br);
+    }
+    const unsigned char* d = br.mem != NULL ? br.mem : br.buf.data();
+    if(br.off + 8 <= br.len)
+    {
+        // carga 8 bytes de una vez; los bits del byte parcial que sobran debajo de nbits
+        // son los mismos que se volverán a cargar, por eso el OR no los altera
+        br.acc |= _bitReaderLoad64(d + br.off) >> br.nbits;
+        br.off += (63 - br.nbits) >> 3;
+        br.nbits |= 56;
+        if(br.nbits == 56)
+        {
+            br.acc |= d[br.off++];
+            br.nbits = 64;
+        }
+    }
+    else
+    {
+        while(br.nbits <= 56 && br.off < br.len)
+        {
+            br.acc |= (uint64_t)d[br.off++] << (56 - br.nbits);
+            br.nbits += 8;
+        }
+    }
+}
+
+uint64_t bitReaderPeekBits(BitReader& br, int n)
+{
+    if(br.nbits < n)
+    {
+        _bitReaderRefill(br);
+    }
+    return n == 0 ? 0 : br.acc >> (64 - n);
+}
+
+void bitReaderSkipBits(BitReader& br, int n)
+{
+    while(n > 0)
+    {
+        if(br.nbits == 0)
+        {
+            _bitReaderRefill(br);
+            if(br.nbits == 0)
+            {
+                return;
+            }
+        }
+        const int k = n < br.nbits ? n : br.nbits;
+        br.acc = k == 64 ? 0 : br.acc << k;
+        br.nbits -= k;
+        n -= k;
+    }
+}
+
+uint64_t bitReaderReadBits(BitReader& br, int n)
+{
+    const uint64_t x = bitReaderPeekBits(br, n);
+    if(n >= br.nbits)
+    {
+        br.acc = 0;
+        br.nbits = 0;
+    }
+    else
+    {
+        br.acc <<= n;
+        br.nbits -= n;
+    }
+    return x;
 }
 
 int bitReaderRead(BitReader& br)
 {
-    if(br.pos % 8 == 0)
+    return (int)bitReaderReadBits(br, 1);
+}
+
+bool bitReaderEof(BitReader& br)
+{
+    if(br.nbits == 0)
     {
-        br.buf = (int)read<unsigned char>(br.f);
-        br.buf = br.buf >= 0 ? br.buf : 256 + br.buf;
-        br.pos = 0;
+        _bitReaderRefill(br);
     }
-    const int mask = pow(2, 7 - br.pos);
-    const int i = br.buf & mask;
-    br.pos++;
-    return i > 0 ? 1 : 0;
+    return br.nbits == 0;
 }
 
 template<typename T>
@@ -30,9 +155,8 @@ std::string _binToString(T t)
     std::string bin;
     for(int i = 0; i <= fin; i++)
     {
-        int mask = pow(2, fin - i);
-        int x = (t & mask) > 0 ? 1 : 0;
+        int x = (t >> (fin - i)) & 1;
         bin += intToString(x);
     }
     return bin;
-}
\ No newline at end of file
+}
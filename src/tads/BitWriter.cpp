@@ -1,38 +1,141 @@
 #include "../../include/tads/BitWriter.h"
 
-#include "../../include/functions/files.h"
 #include "../../include/functions/strings.h"
-#include "../../include/functions/conversions.h"
 
 BitWriter bitWriter(FILE* f)
 {
-    return {f, "", 0};
+    BitWriter bw;
+    bw.f = f;
+    bw.mem = NULL;
+    bw.buf.resize(BITWRITER_BUFFER);
+    bw.len = 0;
+    bw.cap = BITWRITER_BUFFER;
+    bw.acc = 0;
+    bw.nbits = 0;
+    return bw;
+}
+
+BitWriter bitWriter()
+{
+    return bitWriter((FILE*)NULL);
+}
+
+BitWriter bitWriter(unsigned char* data, int cap)
+{
+    BitWriter bw;
+    bw.f = NULL;
+    bw.mem = data;
+    bw.len = 0;
+    bw.cap = cap;
+    bw.acc = 0;
+    bw.nbits = 0;
+    return bw;
+}
+
+const unsigned char* bitWriterData(const BitWriter& bw)
+{
+    return bw.mem != NULL ? bw.mem : bw.buf.data();
+}
+
+int bitWriterSize(const BitWriter& bw)
+{
+    return bw.len;
+}
+
+// escribe los bytes completos del buffer al final del archivo
+void _bitWriterDrain(BitWriter& bw)
+{
+    if(bw.f != NULL && bw.len > 0)
+    {
+        fseek(bw.f, 0, SEEK_END);
+        fwrite(bw.buf.data(), 1, bw.len, bw.f);
+        bw.len = 0;
+    }
+}
+
+// deja lugar para 8 bytes más: vuelca al archivo o agranda el buffer propio
+void _bitWriterMakeRoom(BitWriter& bw)
+{
+    if(bw.f != NULL)
+    {
+        _bitWriterDrain(bw);
+    }
+    else if(bw.mem == NULL)
+    {
+        bw.buf.resize(2 * bw.buf.size() > (size_t)bw.len + 8 ? 2 * bw.buf.size() : (size_t)bw.len + 8);
+        bw.cap = (int)bw.buf.size();
+    }
+}
+
+void bitWriterWriteBits(BitWriter& bw, uint64_t value, int n)
+{
+    if(n > 56)
+    {
+        // el acumulador conserva hasta 7 bits pendientes: se escribe en dos partes
+        bitWriterWriteBits(bw, value >> 32, n - 32);
+        bitWriterWriteBits(bw, value & 0xffffffffu, 32);
+        return;
+    }
+    if(bw.len + 8 > bw.cap)
+    {
+        _bitWriterMakeRoom(bw);
+    }
+
+    const uint64_t mask = n == 0 ? 0 : ~(uint64_t)0 >> (64 - n);
+    bw.acc = bw.acc << n | (value & mask);
+    bw.nbits += n;
+    unsigned char* d = bw.mem != NULL ? bw.mem : bw.buf.data();
+    if(bw.len + 8 <= bw.cap)
+    {
+        while(bw.nbits >= 8)
+        {
+            bw.nbits -= 8;
+            d[bw.len++] = (unsigned char)(bw.acc >> bw.nbits);
+        }
+    }
+    else
+    {
+        // final de un bloque provisto: lo que no entra se descarta pero se cuenta
+        while(bw.nbits >= 8)
+        {
+            bw.nbits -= 8;
+            if(bw.len < bw.cap)
+            {
+                d[bw.len] = (unsigned char)(bw.acc >> bw.nbits);
+            }
+            bw.len++;
+        }
+    }
 }
 
 void bitWriterWrite(BitWriter& bw, const int bit)
 {
-    bw.s += intToString(bit);
-    bw.pos++;
+    bitWriterWriteBits(bw, bit != 0 ? 1 : 0, 1);
 }
 
 void bitWriterWrite(BitWriter& bw, const std::string &sbit)
 {
-    bw.s += sbit;
-    bw.pos += length(sbit);
+    const int n = length(sbit);
+    int i = 0;
+    while(i < n)
+    {
+        const int k = n - i < 56 ? n - i : 56;
+        uint64_t x = 0;
+        for(int j = 0; j < k; j++)
+        {
+            x = x << 1 | (sbit[i + j] == '1' ? 1 : 0);
+        }
+        bitWriterWriteBits(bw, x, k);
+        i += k;
+    }
 }
 
 void bitWriterFlush(BitWriter& bw)
 {
-    seek<char>(bw.f, fileSize<char>(bw.f));
-    while(bw.pos % 8 != 0)
+    if(bw.nbits > 0)
     {
-        bitWriterWrite(bw, 0);
+        bitWriterWriteBits(bw, 0, 8 - bw.nbits);
     }
-    while(bw.s != "")
-    {
-        char a = stringToInt(substring(bw.s, 0, 8), 2);
-        bw.s = substring(bw.s, 8, length(bw.s));
-        write<char>(bw.f, a);
-    }
-    bw.pos = 0;
-}
\ No newline at end of file
+    _bitWriterDrain(bw);
+    bw.acc = 0;
+}
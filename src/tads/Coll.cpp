@@ -1,6 +1,10 @@
 #include "../../include/tads/Coll.h"
 
+#include "../../include/functions/arrays.h"
 #include "../../include/functions/tokens.h"
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
 
 template<typename T>
 Coll<T> coll(char sep)
@@ -9,108 +13,231 @@ Coll<T> coll(char sep)
     c.s = "";
     c.sep = sep;
     c.pos = 0;
+    c.idxLen = -1;
     return c;
 }
 
 template<typename T>
 Coll<T> coll()
 {
-    Coll<T> c;
-    c.s = "";
-    c.sep = '|';
-    c.pos = 0;
-    return c;
+    return coll<T>('|');
+}
+
+template<typename T>
+void _collIndex(const Coll<T>& c)
+{
+    if(c.idxLen == (int)c.s.size())
+    {
+        return;
+    }
+    c.seps.clear();
+    for(int i = 0; i < (int)c.s.size(); i++)
+    {
+        if(c.s[i] == c.sep)
+        {
+            c.seps.push_back(i);
+        }
+    }
+    c.idxLen = (int)c.s.size();
+}
+
+template<typename T>
+int _collTokenStart(const Coll<T>& c, int p)
+{
+    return p == 0 ? 0 : c.seps[p - 1] + 1;
 }
 
 template<typename T>
-int collSize(Coll<T> c)
+int _collTokenEnd(const Coll<T>& c, int p)
 {
-    int i = tokenCount(c.s, c.sep);
-    return i;
+    return p < (int)c.seps.size() ? c.seps[p] : (int)c.s.size();
+}
+
+template<typename T>
+int collSize(const Coll<T>& c)
+{
+    _collIndex<T>(c);
+    return c.s.empty() ? 0 : (int)c.seps.size() + 1;
 }
 
 template<typename T>
 void collRemoveAll(Coll<T>& c)
 {
     c.s = "";
+    c.seps.clear();
+    c.idxLen = 0;
 }
 
 template<typename T>
 void collRemoveAt(Coll<T>& c, int p)
 {
-    removeTokenAt(c.s, c.sep, p);
+    const int n = collSize<T>(c);
+    if(n == 1)
+    {
+        collRemoveAll<T>(c);
+        return;
+    }
+    // se borra el token junto con el separador que lo precede (o lo sigue, si es el primero)
+    const int d = p == 0 ? 0 : c.seps[p - 1];
+    const int h = p == 0 ? c.seps[0] + 1 : _collTokenEnd<T>(c, p);
+    c.s.erase(d, h - d);
+    c.seps.erase(c.seps.begin() + (p == 0 ? 0 : p - 1));
+    for(int j = p == 0 ? 0 : p - 1; j < (int)c.seps.size(); j++)
+    {
+        c.seps[j] -= h - d;
+    }
+    c.idxLen = (int)c.s.size();
 }
 
 template<typename T>
 int collAdd(Coll<T>& c, T t, std::string tToString(T))
 {
-    addToken(c.s, c.sep, tToString(t));
-    return tokenCount(c.s, c.sep) - 1;
+    _collIndex<T>(c);
+    const std::string x = tToString(t);
+    if(!c.s.empty())
+    {
+        c.seps.push_back((int)c.s.size());
+        c.s += c.sep;
+    }
+    const int d = (int)c.s.size();
+    c.s += x;
+    for(int i = 0; i < (int)x.size(); i++)
+    {
+        if(x[i] == c.sep)
+        {
+            c.seps.push_back(d + i);
+        }
+    }
+    c.idxLen = (int)c.s.size();
+    return collSize<T>(c) - 1;
 }
 
 template<typename T>
 void collSetAt(Coll<T>& c, T t, int p, std::string tToString(T))
 {
-    setTokenAt(c.s, c.sep, tToString(t), p);
+    _collIndex<T>(c);
+    const std::string x = tToString(t);
+    const int d = _collTokenStart<T>(c, p);
+    const int h = _collTokenEnd<T>(c, p);
+    c.s.replace(d, h - d, x);
+    if(x.find(c.sep) != std::string::npos)
+    {
+        c.idxLen = -1;
+        return;
+    }
+    const int delta = (int)x.size() - (h - d);
+    for(int j = p; j < (int)c.seps.size(); j++)
+    {
+        c.seps[j] += delta;
+    }
+    c.idxLen = (int)c.s.size();
 }
 
 template<typename T>
-T collGetAt(Coll<T> c, int p, T tFromString(std::string))
+T collGetAt(const Coll<T>& c, int p, T tFromString(std::string))
 {
-    T t;
-    t = tFromString(getTokenAt(c.s, c.sep, p));
-    return t;
+    _collIndex<T>(c);
+    const int d = _collTokenStart<T>(c, p);
+    const int h = _collTokenEnd<T>(c, p);
+    return tFromString(c.s.substr(d, h - d));
 }
 
 template<typename T, typename K>
-int collFind(Coll<T> c, K k, int cmpTK(T, K), T tFromString(std::string))
+int collFind(const Coll<T>& c, K k, int cmpTK(T, K), T tFromString(std::string))
 {
-    int i = 0;
-    while(cmpTK(tFromString(getTokenAt(c.s, c.sep, i)), k) != 0 && i < tokenCount(c.s, c.sep))
+    const int n = collSize<T>(c);
+    for(int i = 0; i < n; i++)
     {
-        i++;
+        if(cmpTK(collGetAt<T>(c, i, tFromString), k) == 0)
+        {
+            return i;
+        }
     }
-    if(cmpTK(tFromString(getTokenAt(c.s, c.sep, i)), k) == 0)
+    return -1;
+}
+
+// envoltorio de un elemento decodificado: evita std::vector<bool>, que no tiene data()
+template<typename T>
+struct _CollItem
+{
+    T t;
+};
+
+template<typename T, typename B>
+std::vector<_CollItem<T>> _collDecode(const Coll<T, B>& c, T tFromString(std::string))
+{
+    const int n = collSize<T>(c);
+    std::vector<_CollItem<T>> v;
+    v.reserve(n);
+    for(int i = 0; i < n; i++)
     {
-        return i;
+        v.push_back({collGetAt<T>(c, i, tFromString)});
     }
-    else
+    return v;
+}
+
+template<typename T, typename B>
+void _collEncode(Coll<T, B>& c, const std::vector<_CollItem<T>>& v, std::string tToString(T))
+{
+    collRemoveAll<T>(c);
+    for(int i = 0; i < (int)v.size(); i++)
     {
-        return -1;
+        collAdd<T>(c, v[i].t, tToString);
     }
 }
 
+template<typename T, typename B>
+void _collStableSort(Coll<T, B>& c, int cmpTT(T, T), T tFromString(std::string), std::string tToString(T))
+{
+    std::vector<_CollItem<T>> v = _collDecode<T>(c, tFromString);
+    stableSortBy<_CollItem<T>>(v.data(), (int)v.size(), [cmpTT](const _CollItem<T>& a, const _CollItem<T>& b) {
+        return cmpTT(a.t, b.t);
+    });
+    _collEncode<T>(c, v, tToString);
+}
+
 template<typename T>
 void collSort(Coll<T>& c, int cmpTT(T, T), T tFromString(std::string), std::string tToString(T))
 {
-    T q;
-    Coll<T> p = coll<T>(c.sep);
-    int i = 0, menor;
-    while(tokenCount(c.s, c.sep) > 0)
+    _collStableSort<T>(c, cmpTT, tFromString, tToString);
+}
+
+template<typename T, typename B>
+void collStableSort(Coll<T, B>& c, int cmpTT(T, T), T tFromString(std::string), std::string tToString(T))
+{
+    _collStableSort<T>(c, cmpTT, tFromString, tToString);
+}
+
+template<typename K>
+struct _CollKey
+{
+    K k;
+    int i;
+};
+
+template<typename T, typename K, typename B>
+void collSortByKey(Coll<T, B>& c, K key(T), int cmpKK(K, K), T tFromString(std::string), std::string tToString(T))
+{
+    std::vector<_CollItem<T>> v = _collDecode<T>(c, tFromString);
+    const int n = (int)v.size();
+    std::vector<_CollKey<K>> keys;
+    keys.reserve(n);
+    for(int i = 0; i < n; i++)
     {
-        while(i < tokenCount(c.s, c.sep))
-        {
-            if(i == 0)
-            {
-                q = tFromString(getTokenAt(c.s, c.sep, i));
-                menor = i;
-            }
-            if(cmpTT(q, tFromString(getTokenAt(c.s, c.sep, i))) > 0)
-            {
-                q = tFromString(getTokenAt(c.s, c.sep, i));
-                menor = i;
-            }
-            i++;
-        }
-        collAdd<T>(p, q, tToString);
-        i = 0;
-        removeTokenAt(c.s, c.sep, menor);
+        keys.push_back({key(v[i].t), i});
+    }
+    stableSortBy<_CollKey<K>>(keys.data(), n, [cmpKK](const _CollKey<K>& a, const _CollKey<K>& b) {
+        return cmpKK(a.k, b.k);
+    });
+    collRemoveAll<T>(c);
+    for(int i = 0; i < n; i++)
+    {
+        collAdd<T>(c, v[keys[i].i].t, tToString);
     }
-    c.s = p.s;
 }
 
 template<typename T>
-bool collHasNext(Coll<T> c)
+bool collHasNext(const Coll<T>& c)
 {
     if(c.pos < collSize<T>(c))
     {
@@ -144,7 +271,213 @@ void collReset(Coll<T>& c)
 }
 
 template<typename T>
-std::string collToString(Coll<T> c)
+const std::string& collToString(const Coll<T>& c)
 {
     return c.s;
-}
\ No newline at end of file
+}
+
+template<typename T>
+CollCursor<T> collCursor(const Coll<T>& c)
+{
+    CollCursor<T> cur;
+    cur.s = c.s;
+    cur.sep = c.sep;
+    cur.off = 0;
+    return cur;
+}
+
+template<typename T>
+bool collCursorHasNext(const CollCursor<T>& cur)
+{
+    return !cur.s.empty() && cur.off <= (int)cur.s.size();
+}
+
+template<typename T>
+std::string_view collCursorNextToken(CollCursor<T>& cur)
+{
+    std::string_view::size_type h = cur.s.find(cur.sep, cur.off);
+    if(h == std::string_view::npos)
+    {
+        h = cur.s.size();
+    }
+    const std::string_view t = cur.s.substr(cur.off, h - cur.off);
+    cur.off = (int)h + 1;
+    return t;
+}
+
+template<typename T>
+T collCursorNext(CollCursor<T>& cur, T tFromString(std::string))
+{
+    return tFromString(std::string(collCursorNextToken<T>(cur)));
+}
+
+template<typename T, typename B>
+Coll<T, B> coll()
+{
+    static_assert(std::is_same<B, CollBinary>::value, "coll<T, B>() sólo crea colecciones binarias");
+    Coll<T, B> c;
+    c.s = "";
+    c.pos = 0;
+    return c;
+}
+
+template<typename T>
+int _collRecordEnd(const Coll<T, CollBinary>& c, int p)
+{
+    return p + 1 < (int)c.offs.size() ? c.offs[p + 1] : (int)c.s.size();
+}
+
+template<typename T>
+std::string _collRecord(const std::string& x)
+{
+    const std::uint32_t n = (std::uint32_t)x.size();
+    std::string r(sizeof(n), '\0');
+    std::memcpy(&r[0], &n, sizeof(n));
+    return r + x;
+}
+
+template<typename T>
+int collSize(const Coll<T, CollBinary>& c)
+{
+    if constexpr(std::is_trivially_copyable<T>::value)
+    {
+        return (int)(c.s.size() / sizeof(T));
+    }
+    else
+    {
+        return (int)c.offs.size();
+    }
+}
+
+template<typename T>
+void collRemoveAll(Coll<T, CollBinary>& c)
+{
+    c.s = "";
+    c.offs.clear();
+}
+
+template<typename T>
+void collRemoveAt(Coll<T, CollBinary>& c, int p)
+{
+    if constexpr(std::is_trivially_copyable<T>::value)
+    {
+        c.s.erase(p * sizeof(T), sizeof(T));
+    }
+    else
+    {
+        const int d = c.offs[p];
+        const int n = _collRecordEnd<T>(c, p) - d;
+        c.s.erase(d, n);
+        c.offs.erase(c.offs.begin() + p);
+        for(int j = p; j < (int)c.offs.size(); j++)
+        {
+            c.offs[j] -= n;
+        }
+    }
+}
+
+template<typename T>
+int collAdd(Coll<T, CollBinary>& c, T t, std::string tToString(T))
+{
+    if constexpr(std::is_trivially_copyable<T>::value)
+    {
+        c.s.append(reinterpret_cast<const char*>(&t), sizeof(T));
+    }
+    else
+    {
+        c.offs.push_back((int)c.s.size());
+        c.s += _collRecord<T>(tToString(t));
+    }
+    return collSize<T>(c) - 1;
+}
+
+template<typename T>
+void collSetAt(Coll<T, CollBinary>& c, T t, int p, std::string tToString(T))
+{
+    if constexpr(std::is_trivially_copyable<T>::value)
+    {
+        std::memcpy(&c.s[p * sizeof(T)], &t, sizeof(T));
+    }
+    else
+    {
+        const std::string r = _collRecord<T>(tToString(t));
+        const int d = c.offs[p];
+        const int n = _collRecordEnd<T>(c, p) - d;
+        c.s.replace(d, n, r);
+        for(int j = p + 1; j < (int)c.offs.size(); j++)
+        {
+            c.offs[j] += (int)r.size() - n;
+        }
+    }
+}
+
+template<typename T>
+T collGetAt(const Coll<T, CollBinary>& c, int p, T tFromString(std::string))
+{
+    if constexpr(std::is_trivially_copyable<T>::value)
+    {
+        T t;
+        std::memcpy(&t, c.s.data() + p * sizeof(T), sizeof(T));
+        return t;
+    }
+    else
+    {
+        std::uint32_t n;
+        std::memcpy(&n, c.s.data() + c.offs[p], sizeof(n));
+        return tFromString(c.s.substr(c.offs[p] + sizeof(n), n));
+    }
+}
+
+template<typename T, typename K>
+int collFind(const Coll<T, CollBinary>& c, K k, int cmpTK(T, K), T tFromString(std::string))
+{
+    const int n = collSize<T>(c);
+    for(int i = 0; i < n; i++)
+    {
+        if(cmpTK(collGetAt<T>(c, i, tFromString), k) == 0)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+template<typename T>
+void collSort(Coll<T, CollBinary>& c, int cmpTT(T, T), T tFromString(std::string), std::string tToString(T))
+{
+    _collStableSort<T>(c, cmpTT, tFromString, tToString);
+}
+
+template<typename T>
+bool collHasNext(const Coll<T, CollBinary>& c)
+{
+    return c.pos < collSize<T>(c);
+}
+
+template<typename T>
+T collNext(Coll<T, CollBinary>& c, T tFromString(std::string))
+{
+    T t = collGetAt<T>(c, c.pos, tFromString);
+    c.pos += 1;
+    return t;
+}
+
+template<typename T>
+T collNext(Coll<T, CollBinary>& c, bool& endOfColl, T tFromString(std::string))
+{
+    T t = collNext<T>(c, tFromString);
+    endOfColl = collHasNext<T>(c);
+    return t;
+}
+
+template<typename T>
+void collReset(Coll<T, CollBinary>& c)
+{
+    c.pos = 0;
+}
+
+template<typename T>
+const std::string& collToString(const Coll<T, CollBinary>& c)
+{
+    return c.s;
+}
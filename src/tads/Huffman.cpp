@@ -0,0 +1,355 @@
+#include "../../include/tads/Huffman.h"
+
+#include <algorithm>
+#include <queue>
+#include <utility>
+
+// longitudes óptimas (sin límite) de los símbolos usados
+std::vector<int> _huffmanDepths(const std::vector<long long>& freq)
+{
+    const int m = (int)freq.size();
+    std::vector<int> padre(2 * m, -1);
+    std::priority_queue<std::pair<long long, int>, std::vector<std::pair<long long, int>>,
+                        std::greater<std::pair<long long, int>>> pq;
+    for(int i = 0; i < m; i++)
+    {
+        pq.push({freq[i], i});
+    }
+    int sig = m;
+    while(pq.size() > 1)
+    {
+        const std::pair<long long, int> a = pq.top();
+        pq.pop();
+        const std::pair<long long, int> b = pq.top();
+        pq.pop();
+        padre[a.second] = sig;
+        padre[b.second] = sig;
+        pq.push({a.first + b.first, sig++});
+    }
+
+    // los nodos internos se crean después de sus hijos: se recorre desde la raíz
+    std::vector<int> prof(sig, 0);
+    for(int i = sig - 2; i >= 0; i--)
+    {
+        prof[i] = prof[padre[i]] + 1;
+    }
+    prof.resize(m);
+    return prof;
+}
+
+Huffman huffman(const int freq[], int n, int maxBits)
+{
+    maxBits = std::max(1, std::min(maxBits, HUFFMAN_MAX_BITS));
+
+    std::vector<int> usados;
+    for(int s = 0; s < n; s++)
+    {
+        if(freq[s] > 0)
+        {
+            usados.push_back(s);
+        }
+    }
+    // más frecuentes primero: recibirán los códigos más cortos
+    std::stable_sort(usados.begin(), usados.end(), [freq](int a, int b) {
+        return freq[a] > freq[b];
+    });
+
+    std::vector<int> lens(n, 0);
+    const int m = (int)usados.size();
+    while(maxBits < HUFFMAN_MAX_BITS && (1 << maxBits) < m)
+    {
+        maxBits++;
+    }
+    if(m == 1)
+    {
+        lens[usados[0]] = 1;
+    }
+    else if(m > 1)
+    {
+        std::vector<long long> f(m);
+        for(int i = 0; i < m; i++)
+        {
+            f[i] = freq[usados[i]];
+        }
+        const std::vector<int> prof = _huffmanDepths(f);
+
+        // cantidad de códigos por longitud, plegando las que exceden maxBits
+        std::vector<int> cuenta(maxBits + 1, 0);
+        for(int i = 0; i < m; i++)
+        {
+            cuenta[std::min(prof[i], maxBits)]++;
+        }
+        // se restablece Kraft: cada paso alarga un código corto y acorta uno de maxBits
+        unsigned long long total = 0;
+        for(int l = 1; l <= maxBits; l++)
+        {
+            total += (unsigned long long)cuenta[l] << (maxBits - l);
+        }
+        while(total > (1ull << maxBits))
+        {
+            cuenta[maxBits]--;
+            for(int l = maxBits - 1; l > 0; l--)
+            {
+                if(cuenta[l] > 0)
+                {
+                    cuenta[l]--;
+                    cuenta[l + 1] += 2;
+                    break;
+                }
+            }
+            total--;
+        }
+
+        int i = 0;
+        for(int l = 1; l <= maxBits; l++)
+        {
+            for(int k = 0; k < cuenta[l]; k++)
+            {
+                lens[usados[i++]] = l;
+            }
+        }
+    }
+    return huffmanFromLengths(lens.data(), n);
+}
+
+Huffman huffmanFromLengths(const int lens[], int n)
+{
+    Huffman h;
+    h.n = 0;
+    h.maxLen = 0;
+    h.tablaBits = 1;
+    h.tabla.assign(2, 0);
+    for(int l = 0; l <= HUFFMAN_MAX_BITS + 1; l++)
+    {
+        h.primero[l] = 0;
+        h.cuenta[l] = 0;
+        h.desde[l] = 0;
+    }
+
+    // desigualdad de Kraft: sum 2^-l <= 1, medida en unidades de 2^-HUFFMAN_MAX_BITS
+    long long kraft = 0;
+    for(int s = 0; s < n; s++)
+    {
+        if(lens[s] < 0 || lens[s] > HUFFMAN_MAX_BITS)
+        {
+            return h;
+        }
+        if(lens[s] > 0)
+        {
+            kraft += 1LL << (HUFFMAN_MAX_BITS - lens[s]);
+        }
+    }
+    if(n < 0 || kraft > 1LL << HUFFMAN_MAX_BITS)
+    {
+        return h;
+    }
+
+    h.n = n;
+    h.lens.assign(lens, lens + n);
+    h.codes.assign(n, 0);
+    for(int s = 0; s < n; s++)
+    {
+        h.cuenta[lens[s]]++;
+        h.maxLen = std::max(h.maxLen, lens[s]);
+    }
+    h.cuenta[0] = 0;
+
+    int code = 0;
+    int pos = 0;
+    for(int l = 1; l <= HUFFMAN_MAX_BITS; l++)
+    {
+        code = (code + h.cuenta[l - 1]) << 1;
+        h.primero[l] = code;
+        h.desde[l] = pos;
+        pos += h.cuenta[l];
+    }
+
+    h.orden.assign(pos, 0);
+    int sig[HUFFMAN_MAX_BITS + 1];
+    for(int l = 1; l <= HUFFMAN_MAX_BITS; l++)
+    {
+        sig[l] = h.desde[l];
+    }
+    for(int s = 0; s < n; s++)
+    {
+        const int l = lens[s];
+        if(l > 0)
+        {
+            h.codes[s] = (uint32_t)(h.primero[l] + sig[l] - h.desde[l]);
+            h.orden[sig[l]++] = s;
+        }
+    }
+
+    h.tablaBits = std::max(1, std::min(h.maxLen, HUFFMAN_TABLE_BITS));
+    h.tabla.assign((size_t)1 << h.tablaBits, 0);
+    for(int s = 0; s < n; s++)
+    {
+        const int l = lens[s];
+        if(l > 0 && l <= h.tablaBits)
+        {
+            const uint32_t d = h.codes[s] << (h.tablaBits - l);
+            const uint32_t k = 1u << (h.tablaBits - l);
+            for(uint32_t j = 0; j < k; j++)
+            {
+                h.tabla[d + j] = (uint32_t)s << 4 | (uint32_t)l;
+            }
+        }
+    }
+    return h;
+}
+
+void huffmanWriteHeader(BitWriter& bw, const Huffman& h)
+{
+    bitWriterWriteBits(bw, (uint64_t)h.n, 16);
+    int s = 0;
+    while(s < h.n)
+    {
+        bitWriterWriteBits(bw, (uint64_t)h.lens[s], 4);
+        if(h.lens[s] == 0)
+        {
+            int r = 0;
+            while(r < 31 && s + 1 + r < h.n && h.lens[s + 1 + r] == 0)
+            {
+                r++;
+            }
+            bitWriterWriteBits(bw, (uint64_t)r, 5);
+            s += r;
+        }
+        s++;
+    }
+}
+
+Huffman huffmanReadHeader(BitReader& br)
+{
+    const int n = (int)bitReaderReadBits(br, 16);
+    std::vector<int> lens(n, 0);
+    int s = 0;
+    while(s < n)
+    {
+        lens[s] = (int)bitReaderReadBits(br, 4);
+        if(lens[s] == 0)
+        {
+            s += (int)bitReaderReadBits(br, 5);
+        }
+        s++;
+    }
+    return huffmanFromLengths(lens.data(), n);
+}
+
+void huffmanEncode(BitWriter& bw, const Huffman& h, int sym)
+{
+    bitWriterWriteBits(bw, h.codes[sym], h.lens[sym]);
+}
+
+template<typename S>
+void _huffmanEncode(BitWriter& bw, const Huffman& h, const S syms[], int len)
+{
+    // se juntan varios códigos en una palabra antes de pasarlos al BitWriter
+    uint64_t acc = 0;
+    int nb = 0;
+    for(int i = 0; i < len; i++)
+    {
+        const int l = h.lens[syms[i]];
+        if(nb + l > 57)
+        {
+            bitWriterWriteBits(bw, acc, nb);
+            acc = 0;
+            nb = 0;
+        }
+        acc = acc << l | h.codes[syms[i]];
+        nb += l;
+    }
+    bitWriterWriteBits(bw, acc, nb);
+}
+
+void huffmanEncode(BitWriter& bw, const Huffman& h, const unsigned char syms[], int len)
+{
+    _huffmanEncode<unsigned char>(bw, h, syms, len);
+}
+
+void huffmanEncode(BitWriter& bw, const Huffman& h, const int syms[], int len)
+{
+    _huffmanEncode<int>(bw, h, syms, len);
+}
+
+// decodifica el código al inicio de x (alineado a la izquierda); retorna símbolo << 4 | longitud
+uint32_t _huffmanLookup(const Huffman& h, uint64_t x)
+{
+    const uint32_t e = h.tabla[x >> (64 - h.tablaBits)];
+    if((e & 15) != 0)
+    {
+        return e;
+    }
+    for(int l = h.tablaBits + 1; l <= h.maxLen; l++)
+    {
+        const int c = (int)(x >> (64 - l)) - h.primero[l];
+        if(c >= 0 && c < h.cuenta[l])
+        {
+            return (uint32_t)h.orden[h.desde[l] + c] << 4 | (uint32_t)l;
+        }
+    }
+    return (uint32_t)(h.orden.empty() ? 0 : h.orden[0]) << 4 | 1;
+}
+
+int huffmanDecode(BitReader& br, const Huffman& h)
+{
+    const uint64_t x = bitReaderPeekBits(br, 57) << 7;
+    const uint32_t e = _huffmanLookup(h, x);
+    bitReaderSkipBits(br, (int)(e & 15));
+    return (int)(e >> 4);
+}
+
+template<typename S>
+void _huffmanDecode(BitReader& br, const Huffman& h, S out[], int len)
+{
+    const int lim = 57 - std::max(h.maxLen, 1);
+    int i = 0;
+    while(i < len)
+    {
+        const uint64_t w = bitReaderPeekBits(br, 57) << 7;
+        int usados = 0;
+        while(i < len && usados <= lim)
+        {
+            const uint32_t e = _huffmanLookup(h, w << usados);
+            out[i++] = (S)(e >> 4);
+            usados += (int)(e & 15);
+        }
+        bitReaderSkipBits(br, usados);
+    }
+}
+
+void huffmanDecode(BitReader& br, const Huffman& h, unsigned char out[], int len)
+{
+    _huffmanDecode<unsigned char>(br, h, out, len);
+}
+
+void huffmanDecode(BitReader& br, const Huffman& h, int out[], int len)
+{
+    _huffmanDecode<int>(br, h, out, len);
+}
+
+void huffmanCompress(BitWriter& bw, const unsigned char data[], int len, int maxBits)
+{
+    int freq[256] = {0};
+    for(int i = 0; i < len; i++)
+    {
+        freq[data[i]]++;
+    }
+    const Huffman h = huffman(freq, 256, maxBits);
+    huffmanWriteHeader(bw, h);
+    bitWriterWriteBits(bw, (uint64_t)(uint32_t)len, 32);
+    huffmanEncode(bw, h, data, len);
+}
+
+std::vector<unsigned char> huffmanDecompress(BitReader& br)
+{
+    const Huffman h = huffmanReadHeader(br);
+    const int len = (int)bitReaderReadBits(br, 32);
+    if(h.n == 0 || len < 0)
+    {
+        return std::vector<unsigned char>();
+    }
+    std::vector<unsigned char> out(len);
+    huffmanDecode(br, h, out.data(), len);
+    return out;
+}
@@ -0,0 +1,228 @@
+#include "../../include/tads/IntCodes.h"
+
+// cantidad de ceros a la izquierda de x (x distinto de 0)
+int _clz64(uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_clzll(x);
+#else
+    int n = 0;
+    while((x & (1ull << 63)) == 0)
+    {
+        x <<= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+void gammaEncode(BitWriter& bw, uint32_t x)
+{
+    // los n ceros iniciales son los bits altos de x escrito en 2n+1 bits
+    const int n = 63 - _clz64(x);
+    bitWriterWriteBits(bw, x, 2 * n + 1);
+}
+
+uint32_t gammaDecode(BitReader& br)
+{
+    const uint64_t w = bitReaderPeekBits(br, 57) << 7;
+    if(w == 0)
+    {
+        bitReaderSkipBits(br, 57);
+        return 0;
+    }
+    const int n = _clz64(w);
+    if(2 * n + 1 <= 57)
+    {
+        bitReaderSkipBits(br, 2 * n + 1);
+        return (uint32_t)(w >> (63 - 2 * n));
+    }
+    if(n > 31)
+    {
+        bitReaderSkipBits(br, n);
+        return 0;
+    }
+    bitReaderSkipBits(br, n);
+    return (uint32_t)bitReaderReadBits(br, n + 1);
+}
+
+void deltaEncode(BitWriter& bw, uint32_t x)
+{
+    const int n = 63 - _clz64(x);
+    gammaEncode(bw, (uint32_t)(n + 1));
+    bitWriterWriteBits(bw, x, n);
+}
+
+uint32_t deltaDecode(BitReader& br)
+{
+    const uint32_t l = gammaDecode(br);
+    if(l == 0 || l > 32)
+    {
+        return 0;
+    }
+    const int n = (int)l - 1;
+    return (uint32_t)(1ull << n | bitReaderReadBits(br, n));
+}
+
+void riceEncode(BitWriter& bw, uint32_t x, int k)
+{
+    uint32_t q = x >> k;
+    const uint64_t r = x & ((1ull << k) - 1);
+    while((uint64_t)q + 1 + k > 64)
+    {
+        bitWriterWriteBits(bw, 0, 32);
+        q -= 32;
+    }
+    // los q ceros del unario son los bits altos de (1 << k | r) escrito en q+1+k bits
+    bitWriterWriteBits(bw, 1ull << k | r, (int)q + 1 + k);
+}
+
+uint32_t riceDecode(BitReader& br, int k)
+{
+    uint32_t q = 0;
+    uint64_t w = bitReaderPeekBits(br, 57) << 7;
+    while(w == 0)
+    {
+        if(bitReaderEof(br))
+        {
+            return 0;
+        }
+        bitReaderSkipBits(br, 57);
+        q += 57;
+        w = bitReaderPeekBits(br, 57) << 7;
+    }
+    const int z = _clz64(w);
+    q += z;
+    if(z + 1 + k <= 57)
+    {
+        const uint32_t r = k == 0 ? 0 : (uint32_t)((w << (z + 1)) >> (64 - k));
+        bitReaderSkipBits(br, z + 1 + k);
+        return q << k | r;
+    }
+    bitReaderSkipBits(br, z + 1);
+    return q << k | (uint32_t)bitReaderReadBits(br, k);
+}
+
+void varintEncode(BitWriter& bw, uint64_t x)
+{
+    // hasta 7 unidades por escritura
+    uint64_t acc = 0;
+    int nb = 0;
+    while(true)
+    {
+        const uint64_t g = x & 0x7f;
+        x >>= 7;
+        acc = acc << 8 | g | (x != 0 ? 0x80 : 0);
+        nb += 8;
+        if(x == 0 || nb == 56)
+        {
+            bitWriterWriteBits(bw, acc, nb);
+            acc = 0;
+            nb = 0;
+        }
+        if(x == 0)
+        {
+            return;
+        }
+    }
+}
+
+uint64_t varintDecode(BitReader& br)
+{
+    uint64_t x = 0;
+    int sh = 0;
+    while(sh < 64)
+    {
+        // 7 unidades alineadas a la izquierda; la primera con el bit alto en 0 termina
+        const uint64_t w = bitReaderPeekBits(br, 56) << 8;
+        const uint64_t fin = ~w & 0x8080808080808000ull;
+        const int nb = fin != 0 ? (_clz64(fin) >> 3) + 1 : 7;
+        for(int i = 0; i < nb && sh < 64; i++)
+        {
+            x |= ((w >> (56 - 8 * i)) & 0x7f) << sh;
+            sh += 7;
+        }
+        bitReaderSkipBits(br, 8 * nb);
+        if(fin != 0)
+        {
+            break;
+        }
+    }
+    return x;
+}
+
+void gammaEncode(BitWriter& bw, const Array<int>& a)
+{
+    varintEncode(bw, (uint64_t)a.len);
+    for(int i = 0; i < a.len; i++)
+    {
+        gammaEncode(bw, (uint32_t)a.arr[i]);
+    }
+}
+
+void gammaDecode(BitReader& br, Array<int>& a)
+{
+    const int n = (int)varintDecode(br);
+    arrayReserve<int>(a, a.len + n);
+    for(int i = 0; i < n; i++)
+    {
+        arrayAdd<int>(a, (int)gammaDecode(br));
+    }
+}
+
+void deltaEncode(BitWriter& bw, const Array<int>& a)
+{
+    varintEncode(bw, (uint64_t)a.len);
+    for(int i = 0; i < a.len; i++)
+    {
+        deltaEncode(bw, (uint32_t)a.arr[i]);
+    }
+}
+
+void deltaDecode(BitReader& br, Array<int>& a)
+{
+    const int n = (int)varintDecode(br);
+    arrayReserve<int>(a, a.len + n);
+    for(int i = 0; i < n; i++)
+    {
+        arrayAdd<int>(a, (int)deltaDecode(br));
+    }
+}
+
+void riceEncode(BitWriter& bw, const Array<int>& a, int k)
+{
+    varintEncode(bw, (uint64_t)a.len);
+    for(int i = 0; i < a.len; i++)
+    {
+        riceEncode(bw, (uint32_t)a.arr[i], k);
+    }
+}
+
+void riceDecode(BitReader& br, Array<int>& a, int k)
+{
+    const int n = (int)varintDecode(br);
+    arrayReserve<int>(a, a.len + n);
+    for(int i = 0; i < n; i++)
+    {
+        arrayAdd<int>(a, (int)riceDecode(br, k));
+    }
+}
+
+void varintEncode(BitWriter& bw, const Array<int>& a)
+{
+    varintEncode(bw, (uint64_t)a.len);
+    for(int i = 0; i < a.len; i++)
+    {
+        varintEncode(bw, (uint64_t)(uint32_t)a.arr[i]);
+    }
+}
+
+void varintDecode(BitReader& br, Array<int>& a)
+{
+    const int n = (int)varintDecode(br);
+    arrayReserve<int>(a, a.len + n);
+    for(int i = 0; i < n; i++)
+    {
+        arrayAdd<int>(a, (int)(uint32_t)varintDecode(br));
+    }
+}
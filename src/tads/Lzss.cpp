@@ -0,0 +1,217 @@
+#include "../../include/tads/Lzss.h"
+
+#include <cstdint>
+#include <cstring>
+
+#define LZSS_HASH_BITS 15
+
+// cantidad de bytes iguales al inicio de a y b, hasta max, comparando de a 8 bytes
+int _lzssMatchLen(const unsigned char* a, const unsigned char* b, int max)
+{
+    int n = 0;
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    while(n + 8 <= max)
+    {
+        uint64_t x;
+        uint64_t y;
+        memcpy(&x, a + n, 8);
+        memcpy(&y, b + n, 8);
+        if(x != y)
+        {
+            return n + (__builtin_ctzll(x ^ y) >> 3);
+        }
+        n += 8;
+    }
+#endif
+    while(n < max && a[n] == b[n])
+    {
+        n++;
+    }
+    return n;
+}
+
+struct _LzssState
+{
+    const unsigned char* data;
+    int len;
+    int mask;                 // tamaño de la ventana - 1
+    int maxLen;               // longitud máxima de una coincidencia
+    std::vector<int> head;    // última posición con cada hash (-1 si ninguna)
+    std::vector<int> prev;    // posición anterior con el mismo hash, indexada por pos & mask
+    int ins;                  // próxima posición a insertar en las cadenas
+};
+
+struct _LzssMatch
+{
+    int len;
+    int dist;
+};
+
+void _lzssInsertUpTo(_LzssState& st, int p)
+{
+    while(st.ins < p)
+    {
+        const int i = st.ins++;
+        if(i + LZSS_MIN_MATCH <= st.len)
+        {
+            const uint32_t k = (uint32_t)st.data[i] << 16 | (uint32_t)st.data[i + 1] << 8 | st.data[i + 2];
+            const int h = (int)((k * 2654435761u) >> (32 - LZSS_HASH_BITS));
+            st.prev[i & st.mask] = st.head[h];
+            st.head[h] = i;
+        }
+    }
+}
+
+// mejor coincidencia para la posición p; las posiciones anteriores ya deben estar insertadas
+_LzssMatch _lzssFind(_LzssState& st, int p)
+{
+    _LzssMatch m = {0, 0};
+    const int max = st.len - p < st.maxLen ? st.len - p : st.maxLen;
+    if(max < LZSS_MIN_MATCH)
+    {
+        return m;
+    }
+    const uint32_t k = (uint32_t)st.data[p] << 16 | (uint32_t)st.data[p + 1] << 8 | st.data[p + 2];
+    int c = st.head[(int)((k * 2654435761u) >> (32 - LZSS_HASH_BITS))];
+    for(int cadena = 0; c >= 0 && p - c <= st.mask && cadena < LZSS_CHAIN; cadena++)
+    {
+        // descarte rápido: el byte que extendería la mejor coincidencia debe coincidir
+        if(st.data[c + m.len] == st.data[p + m.len])
+        {
+            const int n = _lzssMatchLen(st.data + c, st.data + p, max);
+            if(n > m.len)
+            {
+                m.len = n;
+                m.dist = p - c;
+                if(n == max)
+                {
+                    break;
+                }
+            }
+        }
+        c = st.prev[c & st.mask];
+    }
+    if(m.len < LZSS_MIN_MATCH)
+    {
+        m.len = 0;
+    }
+    return m;
+}
+
+void lzssCompress(BitWriter& bw, const unsigned char data[], int len, int windowBits, int lazy)
+{
+    windowBits = windowBits < 8 ? 8 : (windowBits > 24 ? 24 : windowBits);
+
+    _LzssState st;
+    st.data = data;
+    st.len = len;
+    st.mask = (1 << windowBits) - 1;
+    st.maxLen = LZSS_MIN_MATCH + (1 << LZSS_LEN_BITS) - 1;
+    st.head.assign(1 << LZSS_HASH_BITS, -1);
+    st.prev.assign(1 << windowBits, -1);
+    st.ins = 0;
+
+    bitWriterWriteBits(bw, (uint64_t)(uint32_t)len, 32);
+    bitWriterWriteBits(bw, (uint64_t)windowBits, 5);
+    bitWriterWriteBits(bw, (uint64_t)LZSS_LEN_BITS, 4);
+
+    const int bitsMatch = 1 + windowBits + LZSS_LEN_BITS;
+    int p = 0;
+    while(p < len)
+    {
+        _lzssInsertUpTo(st, p);
+        _LzssMatch m = _lzssFind(st, p);
+        if(m.len == 0)
+        {
+            bitWriterWriteBits(bw, data[p], 9);
+            p++;
+            continue;
+        }
+
+        // evaluación diferida: si la posición siguiente tiene una coincidencia más larga,
+        // se emite un literal y se continúa desde allí
+        for(int k = 0; k < lazy && m.len < st.maxLen && p + 1 < len; k++)
+        {
+            _lzssInsertUpTo(st, p + 1);
+            const _LzssMatch m2 = _lzssFind(st, p + 1);
+            if(m2.len <= m.len)
+            {
+                break;
+            }
+            bitWriterWriteBits(bw, data[p], 9);
+            p++;
+            m = m2;
+        }
+
+        const uint64_t t = (uint64_t)1 << (windowBits + LZSS_LEN_BITS)
+                           | (uint64_t)(m.dist - 1) << LZSS_LEN_BITS
+                           | (uint64_t)(m.len - LZSS_MIN_MATCH);
+        bitWriterWriteBits(bw, t, bitsMatch);
+        p += m.len;
+    }
+}
+
+std::vector<unsigned char> lzssDecompress(BitReader& br)
+{
+    const int len = (int)bitReaderReadBits(br, 32);
+    const int windowBits = (int)bitReaderReadBits(br, 5);
+    const int lenBits = (int)bitReaderReadBits(br, 4);
+    if(len < 0 || windowBits < 8 || windowBits > 24 || lenBits == 0)
+    {
+        return std::vector<unsigned char>();
+    }
+    const int bitsMatch = 1 + windowBits + lenBits;
+    const int distMask = (1 << windowBits) - 1;
+    const int lenMask = (1 << lenBits) - 1;
+
+    // 8 bytes de margen para que las copias de a 8 bytes puedan pasarse del final
+    std::vector<unsigned char> out((size_t)len + 8);
+    unsigned char* o = out.data();
+    int n = 0;
+    while(n < len)
+    {
+        if(bitReaderEof(br))
+        {
+            // entrada truncada
+            return std::vector<unsigned char>();
+        }
+        const int nb = bitsMatch > 9 ? bitsMatch : 9;
+        const uint64_t w = bitReaderPeekBits(br, nb);
+        if((w >> (nb - 1)) == 0)
+        {
+            o[n++] = (unsigned char)(w >> (nb - 9));
+            bitReaderSkipBits(br, 9);
+            continue;
+        }
+        const uint64_t t = w >> (nb - bitsMatch);
+        const int dist = (int)((t >> lenBits) & distMask) + 1;
+        int l = (int)(t & lenMask) + LZSS_MIN_MATCH;
+        bitReaderSkipBits(br, bitsMatch);
+        if(dist > n || l > len - n)
+        {
+            // referencia antes del inicio o más allá de la longitud declarada
+            return std::vector<unsigned char>();
+        }
+
+        const unsigned char* s = o + n - dist;
+        unsigned char* d = o + n;
+        if(dist >= 8)
+        {
+            // origen y destino no se solapan dentro de cada palabra
+            for(int i = 0; i < l; i += 8)
+            {
+                memcpy(d + i, s + i, 8);
+            }
+        }
+        else
+        {
+            for(int i = 0; i < l; i++)
+            {
+                d[i] = s[i];
+            }
+        }
+        n += l;
+    }
+    out.resize(len);
+    return out;
+}
@@ -20,7 +20,7 @@ int cmpTT(T a, T b)
 template<typename K, typename V>
 V* mapGet(Map<K,V> m, K k)
 {
-   const int pos = arrayFind<K,K>(m.keys, k, cmpTT<K>);
+   const int pos = arrayFind<K>(m.keys, k);
    if(pos < 0)
    {
       return NULL;
@@ -31,7 +31,7 @@ V* mapGet(Map<K,V> m, K k)
 template<typename K, typename V>
 V* mapPut(Map<K,V>& m, K k, V v)
 {
-   int pos = arrayFind<K,K>(m.keys, k, cmpTT<K>);
+   int pos = arrayFind<K>(m.keys, k);
    if(pos < 0)
    {
       arrayAdd<V>(m.values, v);
@@ -48,13 +48,13 @@ V* mapPut(Map<K,V>& m, K k, V v)
 template<typename K, typename V>
 bool mapContains(Map<K,V> m, K k)
 {
-   return arrayFind<K,K>(m.keys, k, cmpTT<K>) < 0 ? 0 : 1;
+   return arrayFind<K>(m.keys, k) < 0 ? 0 : 1;
 }
 
 template<typename K, typename V>
 V mapRemove(Map<K,V>& m, K k)
 {
-   const int pos = arrayFind<K,K>(m.keys, k, cmpTT<K>);
+   const int pos = arrayFind<K>(m.keys, k);
    arrayRemove<K>(m.keys, pos);
    return arrayRemove<V>(m.values, pos);
 }
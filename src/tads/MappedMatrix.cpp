@@ -0,0 +1,189 @@
+#include "../../include/tads/MappedMatrix.h"
+
+#include "../../include/functions/files.h"
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+template <typename T>
+MappedMatrix<T> mappedMatrix(const char* path, int f, int c, bool escritura, int maxTiles)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "MappedMatrix<T> requiere un T copiable bit a bit");
+
+    MappedMatrix<T> m;
+    m.f = f;
+    m.c = c;
+    m.escritura = escritura;
+    m.tileLen = std::max(1, (int)(MAPPED_MATRIX_TILE_BYTES / sizeof(T)));
+    m.tiles.resize(std::max(1, maxTiles));
+    for(_MappedTile<T>& t : m.tiles)
+    {
+        t.id = -1;
+        t.sucio = false;
+        t.uso = 0;
+    }
+    m.ultimo = 0;
+    m.reloj = 0;
+    m.fallo = false;
+
+    m.arch = fopen(path, escritura ? "r+b" : "rb");
+    if(m.arch == NULL && escritura)
+    {
+        m.arch = fopen(path, "w+b");
+    }
+
+    // un archivo escribible más corto que la matriz se extiende escribiendo el último registro
+    const long long total = (long long)f * c;
+    if(m.arch != NULL && escritura && total > 0)
+    {
+        T ultimo;
+        seek<T>(m.arch, total - 1);
+        if(readBlock<T>(m.arch, &ultimo, 1) < 1)
+        {
+            seek<T>(m.arch, total - 1);
+            write<T>(m.arch, T());
+        }
+    }
+    return m;
+}
+
+template <typename T>
+MappedMatrix<T> mappedMatrix(const char* path, int f, int c, bool escritura)
+{
+    return mappedMatrix<T>(path, f, c, escritura, MAPPED_MATRIX_CACHE_TILES);
+}
+
+template <typename T>
+int _mappedTileSize(const MappedMatrix<T>& m, long long id)
+{
+    const long long total = (long long)m.f * m.c;
+    return (int)std::min<long long>(m.tileLen, total - id * m.tileLen);
+}
+
+// escribe el bloque si tiene cambios; si falla queda sucio y retorna false
+template <typename T>
+bool _mappedFlush(const MappedMatrix<T>& m, _MappedTile<T>& t)
+{
+    if(t.sucio)
+    {
+        const int n = _mappedTileSize<T>(m, t.id);
+        if(!seek<T>(m.arch, t.id * m.tileLen) || writeBlock<T>(m.arch, t.datos.data(), n) < n)
+        {
+            return false;
+        }
+        t.sucio = false;
+    }
+    return true;
+}
+
+// retorna el bloque residente que contiene el elemento x, cargándolo si hace falta
+template <typename T>
+_MappedTile<T>& _mappedTile(const MappedMatrix<T>& m, long long x)
+{
+    const long long id = x / m.tileLen;
+    if(m.tiles[m.ultimo].id == id)
+    {
+        m.tiles[m.ultimo].uso = ++m.reloj;
+        return m.tiles[m.ultimo];
+    }
+
+    auto it = m.idx.find(id);
+    if(it == m.idx.end())
+    {
+        // desalojo del bloque usado hace más tiempo (los libres tienen uso 0)
+        int v = 0;
+        for(int i = 1; i < (int)m.tiles.size(); i++)
+        {
+            if(m.tiles[i].uso < m.tiles[v].uso)
+            {
+                v = i;
+            }
+        }
+        _MappedTile<T>& t = m.tiles[v];
+        if(t.id >= 0)
+        {
+            if(!_mappedFlush<T>(m, t))
+            {
+                // el bloque se reutiliza igual; la pérdida la informa mtxSync
+                m.fallo = true;
+            }
+            m.idx.erase(t.id);
+        }
+
+        const int n = _mappedTileSize<T>(m, id);
+        t.datos.resize(m.tileLen);
+        seek<T>(m.arch, id * m.tileLen);
+        const int leidos = readBlock<T>(m.arch, t.datos.data(), n);
+        if(leidos < n)
+        {
+            memset(static_cast<void*>(t.datos.data() + leidos), 0, (n - leidos) * sizeof(T));
+        }
+        t.id = id;
+        t.sucio = false;
+        it = m.idx.emplace(id, v).first;
+    }
+
+    m.ultimo = it->second;
+    m.tiles[m.ultimo].uso = ++m.reloj;
+    return m.tiles[m.ultimo];
+}
+
+template <typename T>
+bool mtxSync(MappedMatrix<T>& m)
+{
+    if(m.arch == NULL || !m.escritura)
+    {
+        return true;
+    }
+    bool ok = !m.fallo;
+    for(_MappedTile<T>& t : m.tiles)
+    {
+        if(t.id >= 0 && !_mappedFlush<T>(m, t))
+        {
+            ok = false;
+        }
+    }
+    if(fflush(m.arch) != 0)
+    {
+        ok = false;
+    }
+    return ok;
+}
+
+template <typename T>
+void mtxFree(MappedMatrix<T>& m)
+{
+    if(m.arch == NULL)
+    {
+        return;
+    }
+    mtxSync<T>(m);
+    fclose(m.arch);
+    m.arch = NULL;
+    m.tiles.clear();
+    m.idx.clear();
+}
+
+template <typename T>
+T mtxGetAt(const MappedMatrix<T>& m, int f, int c)
+{
+    if(m.arch == NULL)
+    {
+        return T();
+    }
+    const long long x = (long long)f * m.c + c;
+    return _mappedTile<T>(m, x).datos[x % m.tileLen];
+}
+
+template <typename T>
+void mtxSetAt(MappedMatrix<T>& m, T t, int f, int c)
+{
+    if(m.arch == NULL || !m.escritura)
+    {
+        return;
+    }
+    const long long x = (long long)f * m.c + c;
+    _MappedTile<T>& tile = _mappedTile<T>(m, x);
+    tile.datos[x % m.tileLen] = t;
+    tile.sucio = true;
+}
@@ -1,38 +1,586 @@
 #include "../../include/tads/Matrix.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define MATRIX_SIMD_X86
+#include <immintrin.h>
+#endif
+
 template <typename T>
-Matrix<T> matrix(int f, int c, T valorDefault, std::string tToString(T))
+Matrix<T> matrix(int f, int c, T valorDefault, int alin)
 {
+    // std::align_val_t exige una potencia de 2: se redondea hacia arriba
+    int p = (int)alignof(T);
+    while(p < alin)
+    {
+        p *= 2;
+    }
+    alin = p;
+
     Matrix<T> m;
-    m.c = c;
     m.f = f;
+    m.c = c;
+    m.alin = alin;
 
-    m.datos = coll<T>();
-    const int x = c * f;
-    for(int i = 0; i < x; i++)
+    // se rellena cada fila hasta un múltiplo de la alineación, si es posible
+    m.ld = c;
+    if(alin % sizeof(T) == 0)
     {
-        collAdd<T>(m.datos, valorDefault, tToString);
+        const int porBloque = alin / sizeof(T);
+        m.ld = (c + porBloque - 1) / porBloque * porBloque;
+    }
+
+    const size_t x = (size_t)f * m.ld;
+    m.datos = static_cast<T*>(::operator new(x * sizeof(T), std::align_val_t(alin)));
+    for(size_t i = 0; i < x; i++)
+    {
+        new(m.datos + i) T(valorDefault);
     }
 
     return m;
 }
 
 template <typename T>
-int coordenadasToInt(Matrix<T> m, int f, int c)
+Matrix<T> matrix(int f, int c, T valorDefault)
+{
+    return matrix<T>(f, c, valorDefault, MATRIX_ALIGNMENT);
+}
+
+template <typename T>
+Matrix<T> matrix(int f, int c, T valorDefault, std::string (T))
+{
+    return matrix<T>(f, c, valorDefault, MATRIX_ALIGNMENT);
+}
+
+template <typename T>
+void mtxFree(Matrix<T>& m)
+{
+    const size_t x = (size_t)m.f * m.ld;
+    for(size_t i = 0; i < x; i++)
+    {
+        m.datos[i].~T();
+    }
+    ::operator delete(m.datos, std::align_val_t(m.alin));
+    m.datos = NULL;
+    m.f = 0;
+    m.c = 0;
+}
+
+template <typename T>
+Matrix<T> mtxCopy(const Matrix<T>& m)
+{
+    Matrix<T> r = m;
+    const size_t x = (size_t)m.f * m.ld;
+    r.datos = static_cast<T*>(::operator new(x * sizeof(T), std::align_val_t(m.alin)));
+    for(size_t i = 0; i < x; i++)
+    {
+        new(r.datos + i) T(m.datos[i]);
+    }
+    return r;
+}
+
+template <typename T>
+int coordenadasToInt(const Matrix<T>& m, int f, int c)
+{
+    return f * m.ld + c;
+}
+
+template <typename T>
+T* mtxRow(const Matrix<T>& m, int f)
+{
+    return m.datos + (size_t)f * m.ld;
+}
+
+template <typename T>
+T mtxGetAt(const Matrix<T>& m, int f, int c)
+{
+    return mtxRow<T>(m, f)[c];
+}
+
+template <typename T>
+T mtxGetAt(const Matrix<T>& m, int f, int c, T (std::string))
+{
+    return mtxGetAt<T>(m, f, c);
+}
+
+template <typename T>
+void mtxSetAt(Matrix<T>& m, T t, int f, int c)
+{
+    mtxRow<T>(m, f)[c] = std::move(t);
+}
+
+template <typename T>
+void mtxSetAt(Matrix<T>& m, T t, int f, int c, std::string (T))
+{
+    mtxSetAt<T>(m, std::move(t), f, c);
+}
+
+// núcleos sobre tramos contiguos de fila: y += a*x, z = x + y, y = a*x
+
+template <typename T>
+void _mtxAxpyScalar(T* y, const T* x, T a, int n)
+{
+    for(int j = 0; j < n; j++)
+    {
+        y[j] += a * x[j];
+    }
+}
+
+template <typename T>
+void _mtxAddScalar(T* z, const T* x, const T* y, int n)
+{
+    for(int j = 0; j < n; j++)
+    {
+        z[j] = x[j] + y[j];
+    }
+}
+
+template <typename T>
+void _mtxScaleScalar(T* y, const T* x, T a, int n)
 {
-    return f * m.c + c;
+    for(int j = 0; j < n; j++)
+    {
+        y[j] = a * x[j];
+    }
 }
 
+#ifdef MATRIX_SIMD_X86
 template <typename T>
-T mtxGetAt(Matrix<T> m, int f, int c, T tFromString(std::string))
+__attribute__((target("avx2,fma"))) void _mtxAxpyAvx2(T* y, const T* x, T a, int n)
 {
-    const int n = coordenadasToInt<T>(m, f, c);
-    return collGetAt<T>(m.datos, n, tFromString);
+    int j = 0;
+    if constexpr (std::is_same<T, float>::value)
+    {
+        const __m256 va = _mm256_set1_ps(a);
+        for(; j + 8 <= n; j += 8)
+        {
+            _mm256_storeu_ps(y + j, _mm256_fmadd_ps(va, _mm256_loadu_ps(x + j), _mm256_loadu_ps(y + j)));
+        }
+    }
+    else if constexpr (std::is_same<T, double>::value)
+    {
+        const __m256d va = _mm256_set1_pd(a);
+        for(; j + 4 <= n; j += 4)
+        {
+            _mm256_storeu_pd(y + j, _mm256_fmadd_pd(va, _mm256_loadu_pd(x + j), _mm256_loadu_pd(y + j)));
+        }
+    }
+    else
+    {
+        const __m256i va = _mm256_set1_epi32((int) a);
+        for(; j + 8 <= n; j += 8)
+        {
+            const __m256i vx = _mm256_loadu_si256((const __m256i*) (x + j));
+            const __m256i vy = _mm256_loadu_si256((const __m256i*) (y + j));
+            _mm256_storeu_si256((__m256i*) (y + j), _mm256_add_epi32(vy, _mm256_mullo_epi32(va, vx)));
+        }
+    }
+    _mtxAxpyScalar<T>(y + j, x + j, a, n - j);
 }
 
 template <typename T>
-void mtxSetAt(Matrix<T>& m, T t, int f, int c, std::string tToString(T))
+__attribute__((target("avx2"))) void _mtxAddAvx2(T* z, const T* x, const T* y, int n)
 {
-    int n = coordenadasToInt<T>(m, f, c);
-    collSetAt<T>(m.datos, t, n, tToString);
-}
\ No newline at end of file
+    int j = 0;
+    if constexpr (std::is_same<T, float>::value)
+    {
+        for(; j + 8 <= n; j += 8)
+        {
+            _mm256_storeu_ps(z + j, _mm256_add_ps(_mm256_loadu_ps(x + j), _mm256_loadu_ps(y + j)));
+        }
+    }
+    else if constexpr (std::is_same<T, double>::value)
+    {
+        for(; j + 4 <= n; j += 4)
+        {
+            _mm256_storeu_pd(z + j, _mm256_add_pd(_mm256_loadu_pd(x + j), _mm256_loadu_pd(y + j)));
+        }
+    }
+    else
+    {
+        for(; j + 8 <= n; j += 8)
+        {
+            const __m256i vx = _mm256_loadu_si256((const __m256i*) (x + j));
+            const __m256i vy = _mm256_loadu_si256((const __m256i*) (y + j));
+            _mm256_storeu_si256((__m256i*) (z + j), _mm256_add_epi32(vx, vy));
+        }
+    }
+    _mtxAddScalar<T>(z + j, x + j, y + j, n - j);
+}
+
+template <typename T>
+__attribute__((target("avx2"))) void _mtxScaleAvx2(T* y, const T* x, T a, int n)
+{
+    int j = 0;
+    if constexpr (std::is_same<T, float>::value)
+    {
+        const __m256 va = _mm256_set1_ps(a);
+        for(; j + 8 <= n; j += 8)
+        {
+            _mm256_storeu_ps(y + j, _mm256_mul_ps(va, _mm256_loadu_ps(x + j)));
+        }
+    }
+    else if constexpr (std::is_same<T, double>::value)
+    {
+        const __m256d va = _mm256_set1_pd(a);
+        for(; j + 4 <= n; j += 4)
+        {
+            _mm256_storeu_pd(y + j, _mm256_mul_pd(va, _mm256_loadu_pd(x + j)));
+        }
+    }
+    else
+    {
+        const __m256i va = _mm256_set1_epi32((int) a);
+        for(; j + 8 <= n; j += 8)
+        {
+            const __m256i vx = _mm256_loadu_si256((const __m256i*) (x + j));
+            _mm256_storeu_si256((__m256i*) (y + j), _mm256_mullo_epi32(va, vx));
+        }
+    }
+    _mtxScaleScalar<T>(y + j, x + j, a, n - j);
+}
+#endif
+
+template <typename T>
+constexpr bool _mtxVectorizable()
+{
+    return std::is_same<T, float>::value || std::is_same<T, double>::value
+           || (std::is_integral<T>::value && sizeof(T) == 4);
+}
+
+template <typename T>
+void _mtxAxpy(T* y, const T* x, T a, int n)
+{
+#ifdef MATRIX_SIMD_X86
+    if constexpr (_mtxVectorizable<T>())
+    {
+        static const bool avx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+        if(avx2)
+        {
+            _mtxAxpyAvx2<T>(y, x, a, n);
+            return;
+        }
+    }
+#endif
+    _mtxAxpyScalar<T>(y, x, a, n);
+}
+
+template <typename T>
+void _mtxAddRow(T* z, const T* x, const T* y, int n)
+{
+#ifdef MATRIX_SIMD_X86
+    if constexpr (_mtxVectorizable<T>())
+    {
+        static const bool avx2 = __builtin_cpu_supports("avx2");
+        if(avx2)
+        {
+            _mtxAddAvx2<T>(z, x, y, n);
+            return;
+        }
+    }
+#endif
+    _mtxAddScalar<T>(z, x, y, n);
+}
+
+template <typename T>
+void _mtxScaleRow(T* y, const T* x, T a, int n)
+{
+#ifdef MATRIX_SIMD_X86
+    if constexpr (_mtxVectorizable<T>())
+    {
+        static const bool avx2 = __builtin_cpu_supports("avx2");
+        if(avx2)
+        {
+            _mtxScaleAvx2<T>(y, x, a, n);
+            return;
+        }
+    }
+#endif
+    _mtxScaleScalar<T>(y, x, a, n);
+}
+
+template <typename T>
+void mtxMultiplyAdd(Matrix<T>& c, const Matrix<T>& a, const Matrix<T>& b)
+{
+    const int n = a.c;
+    for(int jj = 0; jj < b.c; jj += MATRIX_BLOCK_J)
+    {
+        const int nj = std::min(MATRIX_BLOCK_J, b.c - jj);
+        for(int kk = 0; kk < n; kk += MATRIX_BLOCK_K)
+        {
+            const int kFin = std::min(kk + MATRIX_BLOCK_K, n);
+            // el bloque [kk, kFin) x [jj, jj + nj) de b queda en caché para todas las filas de a
+            for(int i = 0; i < a.f; i++)
+            {
+                T* ci = mtxRow(c, i) + jj;
+                const T* ai = mtxRow(a, i);
+                for(int k = kk; k < kFin; k++)
+                {
+                    _mtxAxpy<T>(ci, mtxRow(b, k) + jj, ai[k], nj);
+                }
+            }
+        }
+    }
+}
+
+template <typename T>
+Matrix<T> mtxMultiply(const Matrix<T>& a, const Matrix<T>& b)
+{
+    Matrix<T> c = matrix<T>(a.f, b.c, T(), a.alin);
+    mtxMultiplyAdd<T>(c, a, b);
+    return c;
+}
+
+template <typename T>
+Matrix<T> mtxAdd(const Matrix<T>& a, const Matrix<T>& b)
+{
+    Matrix<T> c = matrix<T>(a.f, a.c, T(), a.alin);
+    for(int i = 0; i < a.f; i++)
+    {
+        _mtxAddRow<T>(mtxRow(c, i), mtxRow(a, i), mtxRow(b, i), a.c);
+    }
+    return c;
+}
+
+template <typename T>
+Matrix<T> mtxScale(const Matrix<T>& a, T k)
+{
+    Matrix<T> c = matrix<T>(a.f, a.c, T(), a.alin);
+    for(int i = 0; i < a.f; i++)
+    {
+        _mtxScaleRow<T>(mtxRow(c, i), mtxRow(a, i), k, a.c);
+    }
+    return c;
+}
+
+template <typename T>
+Matrix<T> mtxTranspose(const Matrix<T>& a)
+{
+    const int b = 32;
+    Matrix<T> t = matrix<T>(a.c, a.f, T(), a.alin);
+    for(int ii = 0; ii < a.f; ii += b)
+    {
+        const int iFin = std::min(ii + b, a.f);
+        for(int jj = 0; jj < a.c; jj += b)
+        {
+            const int jFin = std::min(jj + b, a.c);
+            for(int i = ii; i < iFin; i++)
+            {
+                const T* ai = mtxRow(a, i);
+                for(int j = jj; j < jFin; j++)
+                {
+                    mtxRow(t, j)[i] = ai[j];
+                }
+            }
+        }
+    }
+    return t;
+}
+
+template <typename T>
+int _mtxThreads(const Matrix<T>& m, int threads)
+{
+    if(threads <= 0)
+    {
+        threads = (int)std::thread::hardware_concurrency();
+    }
+    if(threads > m.f)
+    {
+        threads = m.f;
+    }
+    return threads < 1 ? 1 : threads;
+}
+
+// hilos trabajadores compartidos por todas las operaciones paralelas; se crean a
+// demanda y se reutilizan, así una llamada no paga la creación de los hilos
+struct _MtxPool
+{
+    std::mutex uso;                             // una tarea por vez
+    std::mutex mx;                              // protege los campos siguientes
+    std::condition_variable hayTarea;
+    std::condition_variable terminada;
+    std::vector<std::thread> hilos;
+    const std::function<void(int)>* tarea = NULL;
+    int partes = 0;                             // cantidad de partes de la tarea
+    int sig = 0;                                // siguiente parte sin asignar
+    int pendientes = 0;                         // partes sin terminar
+    unsigned long long gen = 0;                 // número de tarea publicada
+    bool fin = false;
+
+    ~_MtxPool()
+    {
+        {
+            std::lock_guard<std::mutex> lk(mx);
+            fin = true;
+        }
+        hayTarea.notify_all();
+        for(std::thread& h : hilos)
+        {
+            h.join();
+        }
+    }
+};
+
+// verdadero mientras el hilo ejecuta una parte de una tarea del pool
+thread_local bool _mtxEnTarea = false;
+
+_MtxPool& _mtxPool()
+{
+    static _MtxPool p;
+    return p;
+}
+
+// ejecuta partes de la tarea publicada hasta que no quede ninguna sin asignar
+void _mtxPoolWork(_MtxPool& p, std::unique_lock<std::mutex>& lk)
+{
+    while(p.sig < p.partes)
+    {
+        const int t = p.sig++;
+        lk.unlock();
+        _mtxEnTarea = true;
+        (*p.tarea)(t);
+        _mtxEnTarea = false;
+        lk.lock();
+        if(--p.pendientes == 0)
+        {
+            p.terminada.notify_all();
+        }
+    }
+}
+
+void _mtxPoolLoop(_MtxPool& p)
+{
+    unsigned long long visto = 0;
+    std::unique_lock<std::mutex> lk(p.mx);
+    while(true)
+    {
+        p.hayTarea.wait(lk, [&p, visto] { return p.fin || p.gen != visto; });
+        if(p.fin)
+        {
+            return;
+        }
+        visto = p.gen;
+        _mtxPoolWork(p, lk);
+    }
+}
+
+// invoca fn(t) para t en [0, partes) con hasta partes hilos, incluido el que llama;
+// una llamada anidada desde dentro de una tarea corre en serie, porque el pool ya
+// está ocupado por la tarea externa y esperarlo la bloquearía para siempre
+void _mtxPoolRun(int partes, const std::function<void(int)>& fn)
+{
+    if(_mtxEnTarea)
+    {
+        for(int t = 0; t < partes; t++)
+        {
+            fn(t);
+        }
+        return;
+    }
+    _MtxPool& p = _mtxPool();
+    std::lock_guard<std::mutex> uso(p.uso);
+    std::unique_lock<std::mutex> lk(p.mx);
+    while((int)p.hilos.size() < partes - 1)
+    {
+        p.hilos.emplace_back(_mtxPoolLoop, std::ref(p));
+    }
+    p.tarea = &fn;
+    p.partes = partes;
+    p.sig = 0;
+    p.pendientes = partes;
+    p.gen++;
+    p.hayTarea.notify_all();
+
+    _mtxPoolWork(p, lk);
+    p.terminada.wait(lk, [&p] { return p.pendientes == 0; });
+    p.tarea = NULL;
+    p.partes = 0;
+}
+
+// reparte las filas de m en bloques contiguos e invoca fn(t, d, h) para cada hilo t
+template <typename T, typename Fn>
+void _mtxParallelRows(const Matrix<T>& m, int threads, Fn fn)
+{
+    if(threads <= 1)
+    {
+        fn(0, 0, m.f);
+        return;
+    }
+    _mtxPoolRun(threads, [&m, threads, &fn](int t)
+    {
+        const int d = (int)((long long)m.f * t / threads);
+        const int h = (int)((long long)m.f * (t + 1) / threads);
+        fn(t, d, h);
+    });
+}
+
+template <typename T>
+void mtxRowSums(const Matrix<T>& m, T out[], int threads)
+{
+    threads = _mtxThreads<T>(m, threads);
+    _mtxParallelRows<T>(m, threads, [&m, out](int, int d, int h)
+    {
+        for(int i = d; i < h; i++)
+        {
+            const T* fila = mtxRow(m, i);
+            T s = T();
+            for(int j = 0; j < m.c; j++)
+            {
+                s += fila[j];
+            }
+            out[i] = s;
+        }
+    });
+}
+
+template <typename T>
+void mtxColSums(const Matrix<T>& m, T out[], int threads)
+{
+    threads = _mtxThreads<T>(m, threads);
+    // una fila alineada por hilo: las sumas parciales no comparten líneas de caché
+    Matrix<T> parcial = matrix<T>(threads, m.c, T(), m.alin);
+    _mtxParallelRows<T>(m, threads, [&m, &parcial](int t, int d, int h)
+    {
+        T* p = mtxRow(parcial, t);
+        for(int i = d; i < h; i++)
+        {
+            _mtxAddRow<T>(p, p, mtxRow(m, i), m.c);
+        }
+    });
+
+    for(int j = 0; j < m.c; j++)
+    {
+        out[j] = T();
+    }
+    for(int t = 0; t < threads; t++)
+    {
+        _mtxAddRow<T>(out, out, mtxRow(parcial, t), m.c);
+    }
+    mtxFree<T>(parcial);
+}
+
+template <typename T>
+void mtxMap(Matrix<T>& m, T fn(T), int threads)
+{
+    threads = _mtxThreads<T>(m, threads);
+    _mtxParallelRows<T>(m, threads, [&m, fn](int, int d, int h)
+    {
+        for(int i = d; i < h; i++)
+        {
+            T* fila = mtxRow(m, i);
+            for(int j = 0; j < m.c; j++)
+            {
+                fila[j] = fn(fila[j]);
+            }
+        }
+    });
+}
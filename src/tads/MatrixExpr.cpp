@@ -0,0 +1,134 @@
+#include "../../include/tads/MatrixExpr.h"
+
+template <typename L, typename R>
+_MtxBinaria<MtxAdd, L, R> operator+(const L& l, const R& r)
+{
+    return {l, r};
+}
+
+template <typename L, typename R>
+_MtxBinaria<MtxSub, L, R> operator-(const L& l, const R& r)
+{
+    return {l, r};
+}
+
+template <typename L>
+_MtxEscalar<MtxMul, L, typename _MtxTraits<L>::tipo, L> operator*(const L& l, typename _MtxTraits<L>::tipo k)
+{
+    return {l, k};
+}
+
+template <typename R>
+_MtxEscalar<MtxMul, typename _MtxTraits<R>::tipo, R, R> operator*(typename _MtxTraits<R>::tipo k, const R& r)
+{
+    return {k, r};
+}
+
+template <typename L>
+_MtxEscalar<MtxDiv, L, typename _MtxTraits<L>::tipo, L> operator/(const L& l, typename _MtxTraits<L>::tipo k)
+{
+    return {l, k};
+}
+
+template <typename A, typename B>
+auto _mtxApply(MtxAdd, const A& a, const B& b)
+{
+    return a + b;
+}
+
+template <typename A, typename B>
+auto _mtxApply(MtxSub, const A& a, const B& b)
+{
+    return a - b;
+}
+
+template <typename A, typename B>
+auto _mtxApply(MtxMul, const A& a, const B& b)
+{
+    return a * b;
+}
+
+template <typename A, typename B>
+auto _mtxApply(MtxDiv, const A& a, const B& b)
+{
+    return a / b;
+}
+
+// valor de un operando en (i, j): los escalares valen lo mismo en todas las posiciones
+template <typename X>
+const X& _mtxAt(const X& k, int, int)
+{
+    return k;
+}
+
+template <typename T>
+const T& _mtxAt(const Matrix<T>& m, int i, int j)
+{
+    return mtxRow(m, i)[j];
+}
+
+template <typename T, typename Op, typename L, typename R>
+T _mtxAt(const MtxExpr<T, Op, L, R>& e, int i, int j)
+{
+    return _mtxApply(Op(), _mtxAt(e.l, i, j), _mtxAt(e.r, i, j));
+}
+
+// dimensiones: las da el primer operando que no sea escalar
+template <typename T>
+int _mtxFilas(const Matrix<T>& m)
+{
+    return m.f;
+}
+
+template <typename T, typename Op, typename L, typename R>
+int _mtxFilas(const MtxExpr<T, Op, L, R>& e)
+{
+    if constexpr (_MtxTraits<L>::operando)
+    {
+        return _mtxFilas(e.l);
+    }
+    else
+    {
+        return _mtxFilas(e.r);
+    }
+}
+
+template <typename T>
+int _mtxColumnas(const Matrix<T>& m)
+{
+    return m.c;
+}
+
+template <typename T, typename Op, typename L, typename R>
+int _mtxColumnas(const MtxExpr<T, Op, L, R>& e)
+{
+    if constexpr (_MtxTraits<L>::operando)
+    {
+        return _mtxColumnas(e.l);
+    }
+    else
+    {
+        return _mtxColumnas(e.r);
+    }
+}
+
+template <typename T, typename Op, typename L, typename R>
+void mtxAssign(Matrix<T>& m, const MtxExpr<T, Op, L, R>& e)
+{
+    for(int i = 0; i < m.f; i++)
+    {
+        T* fila = mtxRow(m, i);
+        for(int j = 0; j < m.c; j++)
+        {
+            fila[j] = _mtxAt(e, i, j);
+        }
+    }
+}
+
+template <typename T, typename Op, typename L, typename R>
+Matrix<T> mtxEval(const MtxExpr<T, Op, L, R>& e)
+{
+    Matrix<T> m = matrix<T>(_mtxFilas(e), _mtxColumnas(e), T());
+    mtxAssign<T>(m, e);
+    return m;
+}
@@ -0,0 +1,206 @@
+#include "../../include/tads/SmallArray.h"
+
+#include "../../include/functions/arrays.h"
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template<typename T, int N>
+SmallArray<T, N> smallArrayCreate()
+{
+    SmallArray<T, N> a;
+    a.heap = NULL;
+    a.len = 0;
+    a.cap = N;
+    return a;
+}
+
+template<typename T, int N>
+T* smallArrayData(SmallArray<T, N>& a)
+{
+    if(a.heap != NULL)
+    {
+        return a.heap;
+    }
+    return std::launder(reinterpret_cast<T*>(a.buf));
+}
+
+template<typename T, int N>
+void arrayReserve(SmallArray<T, N>& a, int n)
+{
+    if(n <= a.cap)
+    {
+        return;
+    }
+    T* viejo = smallArrayData<T, N>(a);
+    T* nuevo = std::allocator<T>().allocate(n);
+    if constexpr(std::is_trivially_copyable<T>::value)
+    {
+        if(a.len > 0)
+        {
+            std::memcpy(nuevo, viejo, a.len * sizeof(T));
+        }
+    }
+    else
+    {
+        for(int i = 0; i < a.len; i++)
+        {
+            new(nuevo + i) T(std::move(viejo[i]));
+            viejo[i].~T();
+        }
+    }
+    if(a.heap != NULL)
+    {
+        std::allocator<T>().deallocate(a.heap, a.cap);
+    }
+    a.heap = nuevo;
+    a.cap = n;
+}
+
+template<typename T, int N>
+void _smallArrayGrow(SmallArray<T, N>& a)
+{
+    int cap = (int)(a.cap * ARRAY_GROWTH_FACTOR);
+    if(cap <= a.cap)
+    {
+        cap = a.cap + 1;
+    }
+    arrayReserve<T, N>(a, cap);
+}
+
+template<typename T, int N>
+int arrayCapacity(SmallArray<T, N>& a)
+{
+    return a.cap;
+}
+
+template<typename T, int N>
+int arrayAdd(SmallArray<T, N>& a, T t)
+{
+    if(a.len == a.cap)
+    {
+        _smallArrayGrow<T, N>(a);
+    }
+    new(smallArrayData<T, N>(a) + a.len) T(std::move(t));
+    a.len++;
+    return a.len - 1;
+}
+
+template<typename T, int N, typename... Args>
+int arrayEmplace(SmallArray<T, N>& a, Args&&... args)
+{
+    if(a.len == a.cap)
+    {
+        // los argumentos podrían referenciar elementos del propio array
+        T t(std::forward<Args>(args)...);
+        _smallArrayGrow<T, N>(a);
+        new(smallArrayData<T, N>(a) + a.len) T(std::move(t));
+    }
+    else
+    {
+        new(smallArrayData<T, N>(a) + a.len) T(std::forward<Args>(args)...);
+    }
+    a.len++;
+    return a.len - 1;
+}
+
+template<typename T, int N>
+T* arrayGet(SmallArray<T, N>& a, int p)
+{
+    return smallArrayData<T, N>(a) + p;
+}
+
+template<typename T, int N>
+void arraySet(SmallArray<T, N>& a, int p, T t)
+{
+    *arrayGet<T, N>(a, p) = std::move(t);
+}
+
+template<typename T, int N>
+void arrayInsert(SmallArray<T, N>& a, T t, int p)
+{
+    if(a.len == a.cap)
+    {
+        _smallArrayGrow<T, N>(a);
+    }
+    T* arr = smallArrayData<T, N>(a);
+    if(p == a.len)
+    {
+        new(arr + a.len) T(std::move(t));
+        a.len++;
+        return;
+    }
+    // construye la posición libre con el último elemento y desplaza el resto
+    new(arr + a.len) T(std::move(arr[a.len - 1]));
+    int len = a.len - 1;
+    insert<T>(arr, len, std::move(t), p);
+    a.len++;
+}
+
+template<typename T, int N>
+int arraySize(SmallArray<T, N>& a)
+{
+    return a.len;
+}
+
+template<typename T, int N>
+T arrayRemove(SmallArray<T, N>& a, int p)
+{
+    T* arr = smallArrayData<T, N>(a);
+    T t = remove<T>(arr, a.len, p);
+    arr[a.len].~T();
+    return t;
+}
+
+template<typename T, int N>
+void arrayRemoveAll(SmallArray<T, N>& a)
+{
+    if constexpr(!std::is_trivially_destructible<T>::value)
+    {
+        T* arr = smallArrayData<T, N>(a);
+        for(int i = 0; i < a.len; i++)
+        {
+            arr[i].~T();
+        }
+    }
+    a.len = 0;
+}
+
+template<typename T, int N, typename K>
+int arrayFind(SmallArray<T, N>& a, K k, int cmpTK(T, K))
+{
+    return find<T, K>(smallArrayData<T, N>(a), a.len, k, cmpTK);
+}
+
+template<typename T, int N>
+int arrayFind(SmallArray<T, N>& a, T k)
+{
+    return find<T>(smallArrayData<T, N>(a), a.len, k);
+}
+
+template<typename T, int N>
+int arrayOrderedInsert(SmallArray<T, N>& a, T t, int cmpTT(T, T))
+{
+    const int p = lowerBound<T, T>(smallArrayData<T, N>(a), a.len, t, cmpTT);
+    arrayInsert<T, N>(a, std::move(t), p);
+    return p;
+}
+
+template<typename T, int N>
+T* arrayDiscover(SmallArray<T, N>& a, T t, int cmpTT(T, T))
+{
+    int pos = arrayFind<T, N, T>(a, t, cmpTT);
+    if(pos < 0)
+    {
+        pos = arrayAdd<T, N>(a, t);
+    }
+    return arrayGet<T, N>(a, pos);
+}
+
+template<typename T, int N>
+void arraySort(SmallArray<T, N>& a, int cmpTT(T, T))
+{
+    sort<T>(smallArrayData<T, N>(a), a.len, cmpTT);
+}
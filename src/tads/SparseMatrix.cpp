@@ -0,0 +1,216 @@
+#include "../../include/tads/SparseMatrix.h"
+
+#include "../../include/functions/arrays.h"
+#include <type_traits>
+#include <utility>
+
+template <typename T>
+SparseMatrix<T> sparseMatrix(int f, int c, T valorDefault)
+{
+    SparseMatrix<T> m;
+    m.f = f;
+    m.c = c;
+    m.valorDefault = valorDefault;
+    m.filas.assign(f + 1, 0);
+    return m;
+}
+
+template <typename T>
+SparseMatrix<T> sparseMatrix(int f, int c, T valorDefault, const int fs[], const int cs[], const T vs[], int n)
+{
+    SparseMatrix<T> m = sparseMatrix<T>(f, c, valorDefault);
+    m.cooF.assign(fs, fs + n);
+    m.cooC.assign(cs, cs + n);
+    m.cooV.assign(vs, vs + n);
+    spmCompress<T>(m);
+    return m;
+}
+
+template <typename T>
+long long _spmKey(const SparseMatrix<T>& m, int f, int c)
+{
+    return (long long)f * m.c + c;
+}
+
+template <typename T>
+void spmAdd(SparseMatrix<T>& m, int f, int c, T v)
+{
+    auto it = m.cooIdx.find(_spmKey<T>(m, f, c));
+    if(it != m.cooIdx.end())
+    {
+        m.cooV[it->second] = std::move(v);
+        return;
+    }
+    m.cooIdx.emplace(_spmKey<T>(m, f, c), (int)m.cooF.size());
+    m.cooF.push_back(f);
+    m.cooC.push_back(c);
+    m.cooV.push_back(std::move(v));
+}
+
+struct _SpmEntry
+{
+    int f;
+    int c;
+    int i;  // índice en la secuencia [celdas CSR..., ternas pendientes...]
+};
+
+template <typename T>
+void spmCompress(SparseMatrix<T>& m)
+{
+    if(m.cooF.empty())
+    {
+        return;
+    }
+
+    const int nCsr = (int)m.cols.size();
+    const int n = nCsr + (int)m.cooF.size();
+    std::vector<_SpmEntry> e;
+    e.reserve(n);
+    for(int r = 0; r < m.f; r++)
+    {
+        for(int k = m.filas[r]; k < m.filas[r + 1]; k++)
+        {
+            e.push_back({r, m.cols[k], k});
+        }
+    }
+    for(int k = 0; k < (int)m.cooF.size(); k++)
+    {
+        e.push_back({m.cooF[k], m.cooC[k], nCsr + k});
+    }
+
+    // estable: entre celdas repetidas la última escrita queda al final de su tramo
+    stableSortBy<_SpmEntry>(e.data(), n, [](const _SpmEntry& a, const _SpmEntry& b) {
+        if(a.f != b.f)
+        {
+            return a.f < b.f ? -1 : 1;
+        }
+        return a.c < b.c ? -1 : (a.c > b.c ? 1 : 0);
+    });
+
+    std::vector<int> filas(m.f + 1, 0);
+    std::vector<int> cols;
+    std::vector<T> vals;
+    cols.reserve(n);
+    vals.reserve(n);
+    for(int k = 0; k < n; k++)
+    {
+        if(k + 1 < n && e[k + 1].f == e[k].f && e[k + 1].c == e[k].c)
+        {
+            continue;
+        }
+        const int i = e[k].i;
+        cols.push_back(e[k].c);
+        vals.push_back(i < nCsr ? std::move(m.vals[i]) : std::move(m.cooV[i - nCsr]));
+        filas[e[k].f + 1]++;
+    }
+    for(int r = 0; r < m.f; r++)
+    {
+        filas[r + 1] += filas[r];
+    }
+
+    m.filas = std::move(filas);
+    m.cols = std::move(cols);
+    m.vals = std::move(vals);
+    m.cooF.clear();
+    m.cooC.clear();
+    m.cooV.clear();
+    m.cooIdx.clear();
+}
+
+template <typename T>
+int spmSize(const SparseMatrix<T>& m)
+{
+    return (int)(m.cols.size() + m.cooF.size());
+}
+
+template <typename T>
+SparseRow<T> spmRow(const SparseMatrix<T>& m, int f)
+{
+    static_assert(!std::is_same<T, bool>::value, "spmRow no admite SparseMatrix<bool>: std::vector<bool> no expone un T*");
+    const int d = m.filas[f];
+    return {m.cols.data() + d, m.vals.data() + d, m.filas[f + 1] - d};
+}
+
+template <typename T>
+void spmMultiply(const SparseMatrix<T>& m, const T x[], T y[])
+{
+    const bool hayDefault = !(m.valorDefault == T());
+    T sx = T();
+    if(hayDefault)
+    {
+        for(int j = 0; j < m.c; j++)
+        {
+            sx += x[j];
+        }
+    }
+
+    for(int i = 0; i < m.f; i++)
+    {
+        T s = T();
+        if(hayDefault)
+        {
+            // la fila densa equivalente vale valorDefault salvo en las celdas almacenadas
+            s = m.valorDefault * sx;
+            for(int k = m.filas[i]; k < m.filas[i + 1]; k++)
+            {
+                s += (m.vals[k] - m.valorDefault) * x[m.cols[k]];
+            }
+        }
+        else
+        {
+            for(int k = m.filas[i]; k < m.filas[i + 1]; k++)
+            {
+                s += m.vals[k] * x[m.cols[k]];
+            }
+        }
+        y[i] = s;
+    }
+}
+
+template <typename T>
+int _spmFind(const SparseMatrix<T>& m, int f, int c)
+{
+    int d = m.filas[f];
+    int h = m.filas[f + 1];
+    while(d < h)
+    {
+        const int x = d + (h - d) / 2;
+        if(m.cols[x] < c)
+        {
+            d = x + 1;
+        }
+        else
+        {
+            h = x;
+        }
+    }
+    return d < m.filas[f + 1] && m.cols[d] == c ? d : -1;
+}
+
+template <typename T>
+T mtxGetAt(const SparseMatrix<T>& m, int f, int c)
+{
+    auto it = m.cooIdx.find(_spmKey<T>(m, f, c));
+    if(it != m.cooIdx.end())
+    {
+        return m.cooV[it->second];
+    }
+
+    const int k = _spmFind<T>(m, f, c);
+    return k >= 0 ? m.vals[k] : m.valorDefault;
+}
+
+template <typename T>
+void mtxSetAt(SparseMatrix<T>& m, T t, int f, int c)
+{
+    // una terna pendiente de la misma celda ganaría en la compactación: se actualiza ésa
+    const int k = m.cooIdx.count(_spmKey<T>(m, f, c)) ? -1 : _spmFind<T>(m, f, c);
+    if(k >= 0)
+    {
+        m.vals[k] = std::move(t);
+    }
+    else
+    {
+        spmAdd<T>(m, f, c, std::move(t));
+    }
+}